@@ -0,0 +1,3109 @@
+// Generado por test/host/chrome_gen.cpp (make -C test/host chrome): no editar.
+// Fondo fijo de las pantallas por tema en tramos RLE de 16 bits, agrupados por franjas
+// de CHROME_STRIP_HEIGHT filas. Tramo = (longitud - 1) << 4 | índice en la paleta RGB565.
+#pragma once
+#include <stdint.h>
+
+#define CHROME_STRIP_HEIGHT  26
+#define CHROME_STRIPS        13
+#define CHROME_SCREENS       4
+#define CHROME_THEMES        4
+
+struct ChromeImage {
+    const uint16_t* runs;
+    const uint16_t* palette;
+    uint32_t stripStart[CHROME_STRIPS + 1]; // Primer tramo de cada franja
+};
+
+static const uint16_t CHROME_MENU_0_PAL[] = {0xC000, 0xFFFF, 0xF800, 0x1800};
+static const uint16_t CHROME_MENU_0[] = {
+    0xFFF0, 0x3550, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x00F1, 0x0070,
+    0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070, 0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030,
+    0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070, 0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070,
+    0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070,
+    0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070, 0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030,
+    0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070, 0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070,
+    0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0070, 0x00B1, 0x0C10, 0x0950, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0071, 0x0070, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071,
+    0x0070, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071, 0x0070, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0130, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071, 0x0070, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x1530, 0x0031, 0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x1530, 0x0031, 0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031,
+    0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0070, 0x0031,
+    0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0131,
+    0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x1570, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x1570, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1,
+    0x1570, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1,
+    0x00B0, 0x00B1, 0xFFF0, 0x7410, 0x1DF2, 0x1DF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xEFF3,
+};
+
+static const uint16_t CHROME_SETTINGS_0_PAL[] = {0x1800, 0xC000, 0xF800, 0xFFFF, 0xFD20};
+static const uint16_t CHROME_SETTINGS_0[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0x63B0, 0x0011, 0x0A32, 0x0011,
+    0x1350, 0x0011, 0x0012, 0x0A31, 0x0012, 0x0011, 0x1320, 0x0001, 0x0012, 0x0A71, 0x0012, 0x0001,
+    0x1300, 0x0001, 0x0002, 0x0AB1, 0x0002, 0x0001, 0x12E0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001,
+    0x12D0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12C0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001,
+    0x12B0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093,
+    0x0011, 0x0093, 0x0011, 0x0093, 0x0031, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073,
+    0x0031, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0093, 0x0031, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073, 0x0031, 0x0053,
+    0x0471, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0091, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013,
+    0x0091, 0x0013, 0x0051, 0x0033, 0x0031, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x04D1, 0x0002,
+    0x12B0, 0x0002, 0x00D1, 0x0013, 0x0091, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0033, 0x0031, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x04D1, 0x0002, 0x12B0, 0x0002,
+    0x00F1, 0x0053, 0x0031, 0x0073, 0x0071, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x00B1, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002,
+    0x00F1, 0x0053, 0x0031, 0x0073, 0x0071, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x00B1, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002,
+    0x0151, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0031, 0x0033, 0x0011, 0x0013, 0x0031, 0x0033, 0x0091, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002,
+    0x0151, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0031, 0x0033, 0x0011, 0x0013, 0x0031, 0x0033, 0x0091, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002,
+    0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013,
+    0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093,
+    0x0051, 0x0013, 0x0091, 0x0013, 0x0071, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073,
+    0x0031, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093, 0x0051, 0x0013,
+    0x0091, 0x0013, 0x0071, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073, 0x0031, 0x0053,
+    0x0471, 0x0002, 0x12B0, 0x0002, 0x0B11, 0x0002, 0x0950, 0x0950, 0x0002, 0x0B11, 0x0002, 0x12B0,
+    0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12B0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12C0,
+    0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12D0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12E0,
+    0x0001, 0x0002, 0x0AB1, 0x0002, 0x0001, 0x1300, 0x0001, 0x0012, 0x0A71, 0x0012, 0x0001, 0x1320,
+    0x0011, 0x0012, 0x0A31, 0x0012, 0x0011, 0x1350, 0x0011, 0x0A32, 0x0011, 0xFFF0, 0x91D0, 0x0BF1,
+    0x01B0, 0x0BF1, 0x0420, 0x0C11, 0x0190, 0x0C11, 0x0400, 0x0C31, 0x0170, 0x0C31, 0x03E0, 0x0C51,
+    0x0150, 0x0C51, 0x01E0, 0x01D0, 0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0,
+    0x0291, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130, 0x0271, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0,
+    0x0291, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130, 0x0271, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0,
+    0x0271, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033,
+    0x0591, 0x0130, 0x0271, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033,
+    0x0011, 0x0033, 0x0591, 0x0130, 0x0271, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x00B1, 0x0013, 0x0011, 0x0013, 0x0031, 0x0013,
+    0x00D1, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130,
+    0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0611, 0x03B0, 0x0271, 0x0013, 0x00B1, 0x0013,
+    0x0011, 0x0013, 0x0031, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013,
+    0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0611, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0073, 0x0031, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0093, 0x0011, 0x0073,
+    0x0031, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0073, 0x0051, 0x0053, 0x05B1, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0073, 0x0031, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0093, 0x0011, 0x0073,
+    0x0031, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0073, 0x0051, 0x0053, 0x05B1, 0x03B0,
+    0x02F1, 0x0013, 0x0051, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0111, 0x0013,
+    0x0591, 0x03B0, 0x02F1, 0x0013, 0x0051, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013,
+    0x0111, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130,
+    0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0091, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0093, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0, 0x0291, 0x0053,
+    0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0,
+    0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03C0,
+    0x0C51, 0x0150, 0x0C51, 0x03E0, 0x0C31, 0x0170, 0x0C31, 0x0400, 0x0C11, 0x0190, 0x0C11, 0x0420,
+    0x0BF1, 0x01B0, 0x0BF1, 0x3E10, 0x9840, 0x0021, 0x0B34, 0x0021, 0x1230, 0x0011, 0x0024, 0x0B31,
+    0x0024, 0x0011, 0x1200, 0x0001, 0x0014, 0x0B91, 0x0014, 0x0001, 0x11E0, 0x0001, 0x0004, 0x0BD1,
+    0x0004, 0x0001, 0x11C0, 0x0001, 0x0004, 0x0BF1, 0x0004, 0x0001, 0x11A0, 0x0001, 0x0004, 0x0C11,
+    0x0004, 0x0001, 0x1190, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C31,
+    0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31,
+    0x0004, 0x0001, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0034, 0x0011, 0x0004, 0x0041, 0x0044, 0x0011, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0001, 0x0014,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0041, 0x0004, 0x0061, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0011, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0034, 0x0011, 0x0004,
+    0x0041, 0x0034, 0x0021, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004, 0x00C1, 0x0004, 0x0001, 0x0044,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0041, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0041, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0044,
+    0x0001, 0x0044, 0x0011, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0081, 0x0044, 0x0001, 0x0034, 0x0011, 0x0044, 0x0001,
+    0x0044, 0x0061, 0x0034, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x08D1, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x00A1,
+    0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0001, 0x0014, 0x08D1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041,
+    0x0004, 0x00A1, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0891, 0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0011,
+    0x0034, 0x0011, 0x0034, 0x0011, 0x0034, 0x0071, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x08D1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041,
+    0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x00A1, 0x0004, 0x0001, 0x0004, 0x0021,
+    0x0044, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0891, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0041, 0x0004, 0x00A1,
+    0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x08D1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0001,
+    0x0044, 0x0061, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021,
+    0x0004, 0x08D1, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0001, 0x0034, 0x0021, 0x0024,
+    0x0021, 0x0024, 0x0021, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0014,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0034, 0x0011, 0x0034, 0x0021, 0x0024, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0021, 0x0004, 0x08F1, 0x0004,
+    0x1170, 0x0004, 0x0091, 0x0004, 0x0001, 0x0004, 0x0011, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x00A1, 0x0004, 0x0021, 0x0044, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0011, 0x0024, 0x0021, 0x0024, 0x0021, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0031, 0x0024, 0x0011, 0x0044, 0x0001, 0x0044,
+    0x0001, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0014, 0x0001, 0x0014, 0x0011, 0x0004,
+    0x0001, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0991, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004,
+    0x0021, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0024,
+    0x0031, 0x0004, 0x0021, 0x0034, 0x0011, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0044, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0041, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x09A1, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0081,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0024, 0x0031, 0x0004, 0x0021,
+    0x0044, 0x0001, 0x0004, 0x0021, 0x0004, 0x0991, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0031, 0x0004, 0x0021, 0x0044, 0x0001,
+    0x0044, 0x0001, 0x0044, 0x0001, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0081,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021,
+    0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0014, 0x0011, 0x0004, 0x0021, 0x0004, 0x08F1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0034, 0x0011, 0x0034, 0x0011, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0044, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021,
+    0x0004, 0x0041, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0014, 0x0021, 0x0004, 0x08F1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0044, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0034, 0x0011, 0x0044, 0x0011, 0x0024, 0x0011, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0044, 0x0991, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0014, 0x0001, 0x0014, 0x0001, 0x0004, 0x09D1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0034, 0x0031, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x09D1, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0011, 0x0004, 0x0061, 0x0004,
+    0x0031, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0991, 0x0004, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1190, 0x0001,
+    0x0004, 0x0C11, 0x0004, 0x0001, 0x11A0, 0x0001, 0x0004, 0x0BF1, 0x0004, 0x0001, 0x11C0, 0x0001,
+    0x0004, 0x0BD1, 0x0004, 0x0001, 0x11E0, 0x0001, 0x0014, 0x0B91, 0x0014, 0x0001, 0x1200, 0x0011,
+    0x0024, 0x0B31, 0x0024, 0x0011, 0x1230, 0x0021, 0x0B34, 0x0021, 0xA600, 0x9810, 0x0011, 0x0BB4,
+    0x0011, 0x11E0, 0x0001, 0x0014, 0x0BB1, 0x0014, 0x0001, 0x11C0, 0x0001, 0x0004, 0x0BF1, 0x0004,
+    0x0001, 0x11A0, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C31, 0x0004,
+    0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x11A0, 0x0001,
+    0x0004, 0x0BF1, 0x0004, 0x0001, 0x11C0, 0x0001, 0x0014, 0x0BB1, 0x0014, 0x0001, 0x11E0, 0x0011,
+    0x0BB4, 0x0011, 0xFFF0, 0xD1D0, 0xEFF0,
+};
+
+static const uint16_t CHROME_DIAGNOSTICS_0_PAL[] = {0x1800, 0xFD20, 0xE186, 0xC000, 0xFFFF, 0xE73C};
+static const uint16_t CHROME_DIAGNOSTICS_0[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xBDF0, 0x0071, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0030, 0x0091, 0x0030, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0071, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0030, 0x0091, 0x0030, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0070, 0x0011, 0x0010, 0x0011, 0x0030, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0070, 0x0011, 0x0010, 0x0011,
+    0x0030, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0031, 0x0030, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x00D0, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011,
+    0x0090, 0x0011, 0x1650, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0090, 0x0031, 0x0030, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x00D0, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x1650, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0011, 0x0010, 0x0011,
+    0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0070, 0x0011, 0x0090, 0x0011,
+    0x0050, 0x0011, 0x00B0, 0x0051, 0x15F0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0030, 0x0051, 0x0070, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x00B0, 0x0051,
+    0x15F0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0091, 0x0010, 0x0011, 0x0030, 0x0031,
+    0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011,
+    0x0090, 0x0011, 0x0050, 0x0011, 0x0110, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0091, 0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0110, 0x0011,
+    0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x15D0, 0x0071, 0x0050, 0x0051, 0x0030, 0x0011, 0x0050, 0x0011,
+    0x0030, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051, 0x0070, 0x0011,
+    0x0070, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0071, 0x0050, 0x0051, 0x0030, 0x0011,
+    0x0050, 0x0011, 0x0030, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0xBFF0, 0xFFF0, 0x2E10, 0x1972,
+    0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0,
+    0x0272, 0x0094, 0x0012, 0x0094, 0x0012, 0x0094, 0x00D2, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0032, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013,
+    0x03D0, 0x0272, 0x0094, 0x0012, 0x0094, 0x0012, 0x0094, 0x00D2, 0x0074, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F52,
+    0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00B2, 0x0014, 0x0012, 0x0014,
+    0x0032, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x00B2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0032, 0x0014, 0x0012, 0x0014, 0x0F72, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2,
+    0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0F72,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014,
+    0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0092, 0x0094, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0012,
+    0x0014, 0x0092, 0x0014, 0x0092, 0x0094, 0x0052, 0x0014, 0x0F92, 0x0013, 0x01F0, 0x01D0, 0x02B2,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0092,
+    0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014,
+    0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0092, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2,
+    0x0023, 0x03F0, 0x19B2, 0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993,
+    0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2,
+    0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0054, 0x0012, 0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014,
+    0x0172, 0x0014, 0x0052, 0x0054, 0x0072, 0x0014, 0x0132, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013,
+    0x03D0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012,
+    0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014, 0x0172, 0x0014, 0x0052,
+    0x0054, 0x0072, 0x0014, 0x0132, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x01F0, 0x01D0, 0x0272,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072,
+    0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0034, 0x0152, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0034, 0x0112, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0034, 0x0152, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0034, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132,
+    0x0014, 0x0072, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014,
+    0x0132, 0x0014, 0x0072, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014,
+    0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072,
+    0x0014, 0x0132, 0x0014, 0x0092, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0032, 0x0054, 0x0092,
+    0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014,
+    0x0072, 0x0014, 0x0132, 0x0014, 0x0092, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0032, 0x0054,
+    0x0092, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132, 0x0014, 0x00F2, 0x0014, 0x0052, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132, 0x0014, 0x00F2, 0x0014,
+    0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0072,
+    0x0014, 0x0152, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014, 0x0152, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x03D0, 0x02B2, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0112, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013,
+    0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2, 0x0033,
+    0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993, 0x0460, 0x1973, 0x7A30, 0x0210,
+    0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2, 0x0003,
+    0x03E0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012,
+    0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0132, 0x0014, 0x0092, 0x0054, 0x0032, 0x0014, 0x0B32, 0x0013, 0x03D0,
+    0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012, 0x0094,
+    0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052, 0x0054,
+    0x0052, 0x0054, 0x0132, 0x0014, 0x0092, 0x0054, 0x0032, 0x0014, 0x0B32, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072,
+    0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00F2, 0x0034, 0x0072, 0x0014, 0x00B2, 0x0014, 0x0B12, 0x0013, 0x03D0, 0x0272, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072, 0x0014,
+    0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0034, 0x0072, 0x0014, 0x00B2, 0x0014, 0x0B12, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0092, 0x0014, 0x00F2, 0x0014, 0x0072, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0AF2, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0092, 0x0014, 0x00F2, 0x0014,
+    0x0072, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014,
+    0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0054, 0x0112, 0x0014, 0x0092, 0x0054, 0x0052, 0x0074, 0x0012, 0x0094, 0x0052, 0x0014, 0x0052,
+    0x0074, 0x0092, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0054, 0x0112, 0x0014, 0x0092, 0x0054, 0x0052, 0x0074, 0x0012, 0x0094,
+    0x0052, 0x0014, 0x0052, 0x0074, 0x0092, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0172, 0x0014, 0x00F2,
+    0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0AF2,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094,
+    0x0012, 0x0014, 0x0172, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0072, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0192, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0B12, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0192, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0072, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0B12, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0032, 0x0094, 0x0132, 0x0014, 0x0052,
+    0x0054, 0x0032, 0x0054, 0x0132, 0x0054, 0x0052, 0x0054, 0x0052, 0x0014, 0x0B32, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0032, 0x0094, 0x0132, 0x0014, 0x0052, 0x0054,
+    0x0032, 0x0054, 0x0132, 0x0054, 0x0052, 0x0054, 0x0052, 0x0014, 0x0B32, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2,
+    0x0023, 0x03F0, 0x19B2, 0x0033, 0x01F0, 0x0200, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440,
+    0x1993, 0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400,
+    0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0074, 0x0052, 0x0054, 0x0032, 0x0094, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0074, 0x0D32,
+    0x0013, 0x03D0, 0x0272, 0x0074, 0x0052, 0x0054, 0x0032, 0x0094, 0x0052, 0x0014, 0x0052, 0x0074,
+    0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054,
+    0x0052, 0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0074, 0x0D32, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0034, 0x0032,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0034, 0x0032, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0074, 0x0032, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0072, 0x0014, 0x0112,
+    0x0074, 0x0032, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032, 0x0074, 0x0D32, 0x0013, 0x03D0,
+    0x0272, 0x0074, 0x0032, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0074, 0x0072, 0x0014, 0x0112, 0x0074, 0x0032, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074,
+    0x0032, 0x0074, 0x0D32, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0094, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0112,
+    0x0014, 0x0092, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0D52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0094,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0032, 0x0034,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0012, 0x0014, 0x0D52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0032, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0032, 0x0014, 0x0D32, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0032, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0032, 0x0014, 0x0D32, 0x0013, 0x01F0, 0x01D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054,
+    0x0072, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0112, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0074,
+    0x0032, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052,
+    0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0,
+    0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0,
+    0x19D2, 0x0023, 0x03F0, 0x19B2, 0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440,
+    0x1993, 0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400,
+    0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0094, 0x0052, 0x0014, 0x0132, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0032, 0x0094, 0x0032, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0094, 0x0052, 0x0014, 0x0132, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0032, 0x0094,
+    0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0212, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014,
+    0x0052, 0x0014, 0x00D2, 0x0014, 0x0212, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x01F0, 0x01D0, 0x0272, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0034, 0x0052, 0x0014, 0x00B2, 0x0034, 0x0112, 0x0014, 0x0092, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034,
+    0x0032, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0032, 0x0034, 0x0052,
+    0x0014, 0x00B2, 0x0034, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034, 0x0032,
+    0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0C52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014,
+    0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0074, 0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0074, 0x0032,
+    0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0034,
+    0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0034, 0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0034, 0x0C52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014,
+    0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013,
+    0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2,
+    0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52,
+    0x0013, 0x03D0, 0x0292, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0032, 0x0014, 0x00B2, 0x0054,
+    0x0112, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0094, 0x0032, 0x0054, 0x0072, 0x0014, 0x0072, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0292, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0032,
+    0x0014, 0x00B2, 0x0054, 0x0112, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0072, 0x0014, 0x0072, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2,
+    0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993, 0x0460, 0x1973, 0x7C50,
+    0x1972, 0x0460, 0x1992, 0x0240, 0x01F0, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2,
+    0x0003, 0x03E0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032, 0x0074, 0x01D2, 0x0014,
+    0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0094, 0x0012, 0x0094,
+    0x0012, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032,
+    0x0074, 0x01D2, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032,
+    0x0094, 0x0012, 0x0094, 0x0012, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01D2, 0x0014, 0x0112, 0x0034,
+    0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013,
+    0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x01D2, 0x0014, 0x0112, 0x0034, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01F2, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01F2, 0x0014, 0x00F2, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x00F2, 0x0094, 0x0092, 0x0014, 0x00D2, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014,
+    0x0052, 0x0074, 0x0032, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x00F2, 0x0094, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052,
+    0x0074, 0x0032, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0272, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0094, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014,
+    0x0E12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0272, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0094, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0E12, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0252, 0x0014,
+    0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0032, 0x0014, 0x0DF2, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0252, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0032, 0x0014, 0x0DF2, 0x0013, 0x03D0, 0x0292, 0x0054,
+    0x0032, 0x0074, 0x0032, 0x0014, 0x0232, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0DD2, 0x0013, 0x03D0, 0x0292, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0232, 0x0014, 0x0132,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052,
+    0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2,
+    0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0210, 0x0220, 0x1993, 0x0460, 0x1973,
+    0xFFF0, 0x6C50, 0x19B3, 0x0420, 0x19D3, 0x0400, 0x19F3, 0x03E0, 0x1A13, 0x03C0, 0x1A33, 0x03B0,
+    0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0041, 0x0003, 0x0041, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0013, 0x0021, 0x0013, 0x0031, 0x0013, 0x0001, 0x0023, 0x0001, 0x0073, 0x0021, 0x0013, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0041, 0x0013, 0x0021, 0x0403, 0x0035, 0x0033, 0x0005, 0x0033, 0x0025,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x00C3, 0x0005, 0x0023, 0x0005, 0x0003, 0x0045, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0013, 0x0001,
+    0x0093, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001,
+    0x03F3, 0x0005, 0x0023, 0x0005, 0x0013, 0x0005, 0x0003, 0x0005, 0x0013, 0x0005, 0x0023, 0x0005,
+    0x0003, 0x0005, 0x0013, 0x0005, 0x00D3, 0x0015, 0x0003, 0x0015, 0x0003, 0x0005, 0x0043, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0011, 0x0013, 0x0001,
+    0x0003, 0x0001, 0x0063, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x00A3, 0x0001, 0x0023, 0x0011,
+    0x0013, 0x0001, 0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x03B3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0003, 0x0005,
+    0x0043, 0x0005, 0x0083, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0043, 0x0015,
+    0x0013, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0003, 0x0031, 0x0033, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0031, 0x0013, 0x0011, 0x00B3, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0031, 0x0013, 0x0001, 0x0023, 0x0001, 0x03F3, 0x0035,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0015, 0x00F3, 0x0005, 0x0003, 0x0005,
+    0x0003, 0x0005, 0x0003, 0x0035, 0x0013, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0013, 0x0011, 0x0003, 0x0001, 0x0063, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x00A3, 0x0001, 0x0023, 0x0001, 0x0013, 0x0011,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x03B3, 0x0005, 0x0023, 0x0005,
+    0x0003, 0x0045, 0x0003, 0x0005, 0x0043, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0083, 0x0005,
+    0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0013, 0x0015, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0063, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001,
+    0x0013, 0x0001, 0x0013, 0x0001, 0x0013, 0x0001, 0x0093, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x03F3, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0013, 0x0005, 0x00D3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005,
+    0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0041, 0x0023, 0x0001, 0x0033, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0021, 0x0013, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0073, 0x0021, 0x0013, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0053, 0x0021, 0x0403, 0x0035,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x0013, 0x0025, 0x0013, 0x0005, 0x0023, 0x0005, 0x00C3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0045, 0x0003, 0x0005, 0x0023, 0x0005, 0x0013, 0x0025, 0x0D33, 0x01D0,
+    0x01D0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33,
+    0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x01D0,
+};
+
+static const uint16_t CHROME_PATTERNS_0_PAL[] = {0x1800, 0xC000, 0xF800, 0xFFFF, 0xE73C, 0xFD20};
+static const uint16_t CHROME_PATTERNS_0[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0x61D0, 0x0011, 0x0DF2, 0x0011,
+    0x0F90, 0x0011, 0x0012, 0x0DF1, 0x0012, 0x0011, 0x0F60, 0x0001, 0x0012, 0x0E31, 0x0012, 0x0001,
+    0x0F40, 0x0001, 0x0002, 0x0E71, 0x0002, 0x0001, 0x0F20, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001,
+    0x0F10, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F00, 0x0001, 0x0002, 0x0EB1, 0x0002, 0x0001,
+    0x0EF0, 0x0001, 0x0002, 0x00C1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021,
+    0x00E3, 0x0021, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0541, 0x0002, 0x0001,
+    0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00E3,
+    0x0021, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00B3,
+    0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023,
+    0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x0023, 0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002,
+    0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0053,
+    0x0051, 0x0023, 0x0021, 0x0023, 0x05E1, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023,
+    0x0021, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x0021, 0x0053, 0x0051, 0x0023, 0x0021, 0x0023, 0x05E1, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0053, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x05E1, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023,
+    0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0051, 0x0023, 0x0051, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002,
+    0x0770, 0x0770, 0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1,
+    0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0051, 0x0023, 0x0051, 0x0023, 0x0081, 0x0023, 0x0021,
+    0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081,
+    0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0051, 0x0023, 0x0051,
+    0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1,
+    0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00E3, 0x0021,
+    0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0,
+    0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081,
+    0x00E3, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551,
+    0x0002, 0x0EF0, 0x0001, 0x0002, 0x00C1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0051, 0x0083, 0x0541, 0x0002, 0x0001, 0x0EF0, 0x0001, 0x0002, 0x0EB1, 0x0002, 0x0001, 0x0F00,
+    0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F10, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F20,
+    0x0001, 0x0002, 0x0E71, 0x0002, 0x0001, 0x0F40, 0x0001, 0x0012, 0x0E31, 0x0012, 0x0001, 0x0F60,
+    0x0011, 0x0012, 0x0DF1, 0x0012, 0x0011, 0x0F90, 0x0011, 0x0DF2, 0x0011, 0xFFF0, 0xABD0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0x0DF0, 0x3BF2, 0xF091, 0x0043, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0011, 0x0023, 0x0021, 0x0023, 0x0011, 0x0033, 0x0011, 0x0043, 0x0001, 0x0033, 0x0071, 0x0003,
+    0x0021, 0x0003, 0x00E1, 0x0003, 0x0101, 0x0003, 0x0101, 0x0004, 0x0081, 0x0042, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0001, 0x0042, 0x0001, 0x0042, 0x0001, 0x0032, 0x0081, 0x0022, 0x0081, 0x0012,
+    0x0101, 0x0002, 0x00A1, 0x0004, 0x0081, 0x0035, 0x0031, 0x0005, 0x0031, 0x0025, 0x0011, 0x0005,
+    0x0021, 0x0005, 0x0061, 0x0005, 0x0021, 0x0005, 0x01A1, 0x0004, 0x0D41, 0x0003, 0x0041, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0061, 0x0003, 0x0021, 0x0003,
+    0x0201, 0x0003, 0x0101, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0061, 0x0002,
+    0x0021, 0x0002, 0x0081, 0x0002, 0x0101, 0x0002, 0x00A1, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005,
+    0x0011, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005,
+    0x0071, 0x0015, 0x0001, 0x0015, 0x01A1, 0x0004, 0x0D41, 0x0003, 0x0041, 0x0013, 0x0011, 0x0003,
+    0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0041, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0013, 0x0011, 0x0003, 0x0011, 0x0013,
+    0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013, 0x0031, 0x0023, 0x0021, 0x0013, 0x0021, 0x0043,
+    0x0011, 0x0023, 0x0091, 0x0004, 0x0081, 0x0002, 0x0041, 0x0012, 0x0011, 0x0002, 0x0021, 0x0002,
+    0x0021, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0051, 0x0022,
+    0x0031, 0x0002, 0x0031, 0x0022, 0x0021, 0x0022, 0x0011, 0x0042, 0x0081, 0x0004, 0x0081, 0x0005,
+    0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0041, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0011, 0x0025, 0x0011, 0x0005,
+    0x0001, 0x0015, 0x0011, 0x0005, 0x0021, 0x0005, 0x0081, 0x0004, 0x0D41, 0x0033, 0x0011, 0x0003,
+    0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0033, 0x0011, 0x0033, 0x0071, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003,
+    0x0031, 0x0003, 0x0011, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0031, 0x0003, 0x0031, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0121, 0x0032, 0x0011, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0002, 0x0021, 0x0002, 0x0021, 0x0032, 0x0011, 0x0032, 0x0081, 0x0022,
+    0x0011, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0021, 0x0002, 0x0141, 0x0035, 0x0011, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0015, 0x0091, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005,
+    0x0001, 0x0015, 0x0011, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0DE1, 0x0003, 0x0041, 0x0003,
+    0x0011, 0x0013, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0001, 0x0003, 0x0041, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0011, 0x0023, 0x0011, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0011, 0x0023, 0x0031, 0x0003, 0x0021, 0x0043, 0x0081, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002,
+    0x0011, 0x0012, 0x0021, 0x0002, 0x0021, 0x0002, 0x0041, 0x0002, 0x0001, 0x0002, 0x0041, 0x0002,
+    0x0061, 0x0002, 0x0001, 0x0042, 0x0021, 0x0002, 0x0021, 0x0042, 0x0001, 0x0002, 0x0061, 0x0002,
+    0x00A1, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005, 0x0001, 0x0045, 0x0001, 0x0005, 0x0041, 0x0005,
+    0x0001, 0x0005, 0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0045,
+    0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0081, 0x0004, 0x0D41, 0x0003,
+    0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0011, 0x0003, 0x0071, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0011, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0031, 0x0003,
+    0x0031, 0x0013, 0x0001, 0x0003, 0x0001, 0x0003, 0x0011, 0x0003, 0x0031, 0x0003, 0x0001, 0x0003,
+    0x0001, 0x0003, 0x00C1, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002,
+    0x0021, 0x0002, 0x0041, 0x0002, 0x0011, 0x0002, 0x0071, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0061, 0x0002, 0x0021, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0081, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005, 0x0071, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0015, 0x0081, 0x0004, 0x0D41, 0x0043,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0011, 0x0023, 0x0021, 0x0023, 0x0011, 0x0033, 0x0011, 0x0043,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0061, 0x0003, 0x0021, 0x0003, 0x0011, 0x0033, 0x0021, 0x0003,
+    0x0031, 0x0023, 0x0051, 0x0003, 0x0011, 0x0033, 0x0031, 0x0003, 0x0021, 0x0023, 0x0091, 0x0004,
+    0x0081, 0x0042, 0x0001, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0042, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0071, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022,
+    0x0041, 0x0002, 0x0091, 0x0004, 0x0081, 0x0035, 0x0011, 0x0005, 0x0021, 0x0005, 0x0011, 0x0025,
+    0x0011, 0x0005, 0x0021, 0x0005, 0x0061, 0x0005, 0x0021, 0x0005, 0x0011, 0x0025, 0x0011, 0x0005,
+    0x0021, 0x0005, 0x0011, 0x0015, 0x0001, 0x0005, 0x0081, 0x0004, 0x0CA1, 0x0521, 0x0023, 0xEA91,
+};
+
+static const uint16_t CHROME_MENU_1_PAL[] = {0x1082, 0xFFFF, 0x3D8F, 0x0821};
+static const uint16_t CHROME_MENU_1[] = {
+    0xFFF0, 0x3550, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x00F1, 0x0070,
+    0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070, 0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030,
+    0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070, 0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070,
+    0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070,
+    0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070, 0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030,
+    0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070, 0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070,
+    0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0070, 0x00B1, 0x0C10, 0x0950, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0071, 0x0070, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071,
+    0x0070, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071, 0x0070, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0130, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071, 0x0070, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x1530, 0x0031, 0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x1530, 0x0031, 0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031,
+    0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0070, 0x0031,
+    0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0131,
+    0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x1570, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x1570, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1,
+    0x1570, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1,
+    0x00B0, 0x00B1, 0xFFF0, 0x7410, 0x1DF2, 0x1DF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xEFF3,
+};
+
+static const uint16_t CHROME_SETTINGS_1_PAL[] = {0x0821, 0x1082, 0x3D8F, 0xFFFF, 0x04FF};
+static const uint16_t CHROME_SETTINGS_1[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0x63B0, 0x0011, 0x0A32, 0x0011,
+    0x1350, 0x0011, 0x0012, 0x0A31, 0x0012, 0x0011, 0x1320, 0x0001, 0x0012, 0x0A71, 0x0012, 0x0001,
+    0x1300, 0x0001, 0x0002, 0x0AB1, 0x0002, 0x0001, 0x12E0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001,
+    0x12D0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12C0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001,
+    0x12B0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093,
+    0x0011, 0x0093, 0x0011, 0x0093, 0x0031, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073,
+    0x0031, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0093, 0x0031, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073, 0x0031, 0x0053,
+    0x0471, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0091, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013,
+    0x0091, 0x0013, 0x0051, 0x0033, 0x0031, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x04D1, 0x0002,
+    0x12B0, 0x0002, 0x00D1, 0x0013, 0x0091, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0033, 0x0031, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x04D1, 0x0002, 0x12B0, 0x0002,
+    0x00F1, 0x0053, 0x0031, 0x0073, 0x0071, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x00B1, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002,
+    0x00F1, 0x0053, 0x0031, 0x0073, 0x0071, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x00B1, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002,
+    0x0151, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0031, 0x0033, 0x0011, 0x0013, 0x0031, 0x0033, 0x0091, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002,
+    0x0151, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0031, 0x0033, 0x0011, 0x0013, 0x0031, 0x0033, 0x0091, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002,
+    0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013,
+    0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093,
+    0x0051, 0x0013, 0x0091, 0x0013, 0x0071, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073,
+    0x0031, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093, 0x0051, 0x0013,
+    0x0091, 0x0013, 0x0071, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073, 0x0031, 0x0053,
+    0x0471, 0x0002, 0x12B0, 0x0002, 0x0B11, 0x0002, 0x0950, 0x0950, 0x0002, 0x0B11, 0x0002, 0x12B0,
+    0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12B0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12C0,
+    0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12D0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12E0,
+    0x0001, 0x0002, 0x0AB1, 0x0002, 0x0001, 0x1300, 0x0001, 0x0012, 0x0A71, 0x0012, 0x0001, 0x1320,
+    0x0011, 0x0012, 0x0A31, 0x0012, 0x0011, 0x1350, 0x0011, 0x0A32, 0x0011, 0xFFF0, 0x91D0, 0x0BF1,
+    0x01B0, 0x0BF1, 0x0420, 0x0C11, 0x0190, 0x0C11, 0x0400, 0x0C31, 0x0170, 0x0C31, 0x03E0, 0x0C51,
+    0x0150, 0x0C51, 0x01E0, 0x01D0, 0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0,
+    0x0291, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130, 0x0271, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0,
+    0x0291, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130, 0x0271, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0,
+    0x0271, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033,
+    0x0591, 0x0130, 0x0271, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033,
+    0x0011, 0x0033, 0x0591, 0x0130, 0x0271, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x00B1, 0x0013, 0x0011, 0x0013, 0x0031, 0x0013,
+    0x00D1, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130,
+    0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0611, 0x03B0, 0x0271, 0x0013, 0x00B1, 0x0013,
+    0x0011, 0x0013, 0x0031, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013,
+    0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0611, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0073, 0x0031, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0093, 0x0011, 0x0073,
+    0x0031, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0073, 0x0051, 0x0053, 0x05B1, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0073, 0x0031, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0093, 0x0011, 0x0073,
+    0x0031, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0073, 0x0051, 0x0053, 0x05B1, 0x03B0,
+    0x02F1, 0x0013, 0x0051, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0111, 0x0013,
+    0x0591, 0x03B0, 0x02F1, 0x0013, 0x0051, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013,
+    0x0111, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130,
+    0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0091, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0093, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0, 0x0291, 0x0053,
+    0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0,
+    0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03C0,
+    0x0C51, 0x0150, 0x0C51, 0x03E0, 0x0C31, 0x0170, 0x0C31, 0x0400, 0x0C11, 0x0190, 0x0C11, 0x0420,
+    0x0BF1, 0x01B0, 0x0BF1, 0x3E10, 0x9840, 0x0021, 0x0B34, 0x0021, 0x1230, 0x0011, 0x0024, 0x0B31,
+    0x0024, 0x0011, 0x1200, 0x0001, 0x0014, 0x0B91, 0x0014, 0x0001, 0x11E0, 0x0001, 0x0004, 0x0BD1,
+    0x0004, 0x0001, 0x11C0, 0x0001, 0x0004, 0x0BF1, 0x0004, 0x0001, 0x11A0, 0x0001, 0x0004, 0x0C11,
+    0x0004, 0x0001, 0x1190, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C31,
+    0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31,
+    0x0004, 0x0001, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0034, 0x0011, 0x0004, 0x0041, 0x0044, 0x0011, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0001, 0x0014,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0041, 0x0004, 0x0061, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0011, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0034, 0x0011, 0x0004,
+    0x0041, 0x0034, 0x0021, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004, 0x00C1, 0x0004, 0x0001, 0x0044,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0041, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0041, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0044,
+    0x0001, 0x0044, 0x0011, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0081, 0x0044, 0x0001, 0x0034, 0x0011, 0x0044, 0x0001,
+    0x0044, 0x0061, 0x0034, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x08D1, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x00A1,
+    0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0001, 0x0014, 0x08D1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041,
+    0x0004, 0x00A1, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0891, 0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0011,
+    0x0034, 0x0011, 0x0034, 0x0011, 0x0034, 0x0071, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x08D1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041,
+    0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x00A1, 0x0004, 0x0001, 0x0004, 0x0021,
+    0x0044, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0891, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0041, 0x0004, 0x00A1,
+    0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x08D1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0001,
+    0x0044, 0x0061, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021,
+    0x0004, 0x08D1, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0001, 0x0034, 0x0021, 0x0024,
+    0x0021, 0x0024, 0x0021, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0014,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0034, 0x0011, 0x0034, 0x0021, 0x0024, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0021, 0x0004, 0x08F1, 0x0004,
+    0x1170, 0x0004, 0x0091, 0x0004, 0x0001, 0x0004, 0x0011, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x00A1, 0x0004, 0x0021, 0x0044, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0011, 0x0024, 0x0021, 0x0024, 0x0021, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0031, 0x0024, 0x0011, 0x0044, 0x0001, 0x0044,
+    0x0001, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0014, 0x0001, 0x0014, 0x0011, 0x0004,
+    0x0001, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0991, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004,
+    0x0021, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0024,
+    0x0031, 0x0004, 0x0021, 0x0034, 0x0011, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0044, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0041, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x09A1, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0081,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0024, 0x0031, 0x0004, 0x0021,
+    0x0044, 0x0001, 0x0004, 0x0021, 0x0004, 0x0991, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0031, 0x0004, 0x0021, 0x0044, 0x0001,
+    0x0044, 0x0001, 0x0044, 0x0001, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0081,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021,
+    0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0014, 0x0011, 0x0004, 0x0021, 0x0004, 0x08F1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0034, 0x0011, 0x0034, 0x0011, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0044, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021,
+    0x0004, 0x0041, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0014, 0x0021, 0x0004, 0x08F1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0044, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0034, 0x0011, 0x0044, 0x0011, 0x0024, 0x0011, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0044, 0x0991, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0014, 0x0001, 0x0014, 0x0001, 0x0004, 0x09D1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0034, 0x0031, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x09D1, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0011, 0x0004, 0x0061, 0x0004,
+    0x0031, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0991, 0x0004, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1190, 0x0001,
+    0x0004, 0x0C11, 0x0004, 0x0001, 0x11A0, 0x0001, 0x0004, 0x0BF1, 0x0004, 0x0001, 0x11C0, 0x0001,
+    0x0004, 0x0BD1, 0x0004, 0x0001, 0x11E0, 0x0001, 0x0014, 0x0B91, 0x0014, 0x0001, 0x1200, 0x0011,
+    0x0024, 0x0B31, 0x0024, 0x0011, 0x1230, 0x0021, 0x0B34, 0x0021, 0xA600, 0x9810, 0x0011, 0x0BB4,
+    0x0011, 0x11E0, 0x0001, 0x0014, 0x0BB1, 0x0014, 0x0001, 0x11C0, 0x0001, 0x0004, 0x0BF1, 0x0004,
+    0x0001, 0x11A0, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C31, 0x0004,
+    0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x11A0, 0x0001,
+    0x0004, 0x0BF1, 0x0004, 0x0001, 0x11C0, 0x0001, 0x0014, 0x0BB1, 0x0014, 0x0001, 0x11E0, 0x0011,
+    0x0BB4, 0x0011, 0xFFF0, 0xD1D0, 0xEFF0,
+};
+
+static const uint16_t CHROME_DIAGNOSTICS_1_PAL[] = {0x0821, 0x04FF, 0x2945, 0x1082, 0xFFFF, 0xBDF7};
+static const uint16_t CHROME_DIAGNOSTICS_1[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xBDF0, 0x0071, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0030, 0x0091, 0x0030, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0071, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0030, 0x0091, 0x0030, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0070, 0x0011, 0x0010, 0x0011, 0x0030, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0070, 0x0011, 0x0010, 0x0011,
+    0x0030, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0031, 0x0030, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x00D0, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011,
+    0x0090, 0x0011, 0x1650, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0090, 0x0031, 0x0030, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x00D0, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x1650, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0011, 0x0010, 0x0011,
+    0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0070, 0x0011, 0x0090, 0x0011,
+    0x0050, 0x0011, 0x00B0, 0x0051, 0x15F0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0030, 0x0051, 0x0070, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x00B0, 0x0051,
+    0x15F0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0091, 0x0010, 0x0011, 0x0030, 0x0031,
+    0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011,
+    0x0090, 0x0011, 0x0050, 0x0011, 0x0110, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0091, 0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0110, 0x0011,
+    0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x15D0, 0x0071, 0x0050, 0x0051, 0x0030, 0x0011, 0x0050, 0x0011,
+    0x0030, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051, 0x0070, 0x0011,
+    0x0070, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0071, 0x0050, 0x0051, 0x0030, 0x0011,
+    0x0050, 0x0011, 0x0030, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0xBFF0, 0xFFF0, 0x2E10, 0x1972,
+    0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0,
+    0x0272, 0x0094, 0x0012, 0x0094, 0x0012, 0x0094, 0x00D2, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0032, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013,
+    0x03D0, 0x0272, 0x0094, 0x0012, 0x0094, 0x0012, 0x0094, 0x00D2, 0x0074, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F52,
+    0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00B2, 0x0014, 0x0012, 0x0014,
+    0x0032, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x00B2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0032, 0x0014, 0x0012, 0x0014, 0x0F72, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2,
+    0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0F72,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014,
+    0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0092, 0x0094, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0012,
+    0x0014, 0x0092, 0x0014, 0x0092, 0x0094, 0x0052, 0x0014, 0x0F92, 0x0013, 0x01F0, 0x01D0, 0x02B2,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0092,
+    0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014,
+    0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0092, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2,
+    0x0023, 0x03F0, 0x19B2, 0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993,
+    0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2,
+    0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0054, 0x0012, 0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014,
+    0x0172, 0x0014, 0x0052, 0x0054, 0x0072, 0x0014, 0x0132, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013,
+    0x03D0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012,
+    0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014, 0x0172, 0x0014, 0x0052,
+    0x0054, 0x0072, 0x0014, 0x0132, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x01F0, 0x01D0, 0x0272,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072,
+    0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0034, 0x0152, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0034, 0x0112, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0034, 0x0152, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0034, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132,
+    0x0014, 0x0072, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014,
+    0x0132, 0x0014, 0x0072, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014,
+    0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072,
+    0x0014, 0x0132, 0x0014, 0x0092, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0032, 0x0054, 0x0092,
+    0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014,
+    0x0072, 0x0014, 0x0132, 0x0014, 0x0092, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0032, 0x0054,
+    0x0092, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132, 0x0014, 0x00F2, 0x0014, 0x0052, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132, 0x0014, 0x00F2, 0x0014,
+    0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0072,
+    0x0014, 0x0152, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014, 0x0152, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x03D0, 0x02B2, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0112, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013,
+    0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2, 0x0033,
+    0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993, 0x0460, 0x1973, 0x7A30, 0x0210,
+    0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2, 0x0003,
+    0x03E0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012,
+    0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0132, 0x0014, 0x0092, 0x0054, 0x0032, 0x0014, 0x0B32, 0x0013, 0x03D0,
+    0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012, 0x0094,
+    0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052, 0x0054,
+    0x0052, 0x0054, 0x0132, 0x0014, 0x0092, 0x0054, 0x0032, 0x0014, 0x0B32, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072,
+    0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00F2, 0x0034, 0x0072, 0x0014, 0x00B2, 0x0014, 0x0B12, 0x0013, 0x03D0, 0x0272, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072, 0x0014,
+    0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0034, 0x0072, 0x0014, 0x00B2, 0x0014, 0x0B12, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0092, 0x0014, 0x00F2, 0x0014, 0x0072, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0AF2, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0092, 0x0014, 0x00F2, 0x0014,
+    0x0072, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014,
+    0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0054, 0x0112, 0x0014, 0x0092, 0x0054, 0x0052, 0x0074, 0x0012, 0x0094, 0x0052, 0x0014, 0x0052,
+    0x0074, 0x0092, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0054, 0x0112, 0x0014, 0x0092, 0x0054, 0x0052, 0x0074, 0x0012, 0x0094,
+    0x0052, 0x0014, 0x0052, 0x0074, 0x0092, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0172, 0x0014, 0x00F2,
+    0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0AF2,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094,
+    0x0012, 0x0014, 0x0172, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0072, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0192, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0B12, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0192, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0072, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0B12, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0032, 0x0094, 0x0132, 0x0014, 0x0052,
+    0x0054, 0x0032, 0x0054, 0x0132, 0x0054, 0x0052, 0x0054, 0x0052, 0x0014, 0x0B32, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0032, 0x0094, 0x0132, 0x0014, 0x0052, 0x0054,
+    0x0032, 0x0054, 0x0132, 0x0054, 0x0052, 0x0054, 0x0052, 0x0014, 0x0B32, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2,
+    0x0023, 0x03F0, 0x19B2, 0x0033, 0x01F0, 0x0200, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440,
+    0x1993, 0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400,
+    0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0074, 0x0052, 0x0054, 0x0032, 0x0094, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0074, 0x0D32,
+    0x0013, 0x03D0, 0x0272, 0x0074, 0x0052, 0x0054, 0x0032, 0x0094, 0x0052, 0x0014, 0x0052, 0x0074,
+    0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054,
+    0x0052, 0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0074, 0x0D32, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0034, 0x0032,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0034, 0x0032, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0074, 0x0032, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0072, 0x0014, 0x0112,
+    0x0074, 0x0032, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032, 0x0074, 0x0D32, 0x0013, 0x03D0,
+    0x0272, 0x0074, 0x0032, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0074, 0x0072, 0x0014, 0x0112, 0x0074, 0x0032, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074,
+    0x0032, 0x0074, 0x0D32, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0094, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0112,
+    0x0014, 0x0092, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0D52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0094,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0032, 0x0034,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0012, 0x0014, 0x0D52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0032, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0032, 0x0014, 0x0D32, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0032, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0032, 0x0014, 0x0D32, 0x0013, 0x01F0, 0x01D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054,
+    0x0072, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0112, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0074,
+    0x0032, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052,
+    0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0,
+    0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0,
+    0x19D2, 0x0023, 0x03F0, 0x19B2, 0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440,
+    0x1993, 0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400,
+    0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0094, 0x0052, 0x0014, 0x0132, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0032, 0x0094, 0x0032, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0094, 0x0052, 0x0014, 0x0132, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0032, 0x0094,
+    0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0212, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014,
+    0x0052, 0x0014, 0x00D2, 0x0014, 0x0212, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x01F0, 0x01D0, 0x0272, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0034, 0x0052, 0x0014, 0x00B2, 0x0034, 0x0112, 0x0014, 0x0092, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034,
+    0x0032, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0032, 0x0034, 0x0052,
+    0x0014, 0x00B2, 0x0034, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034, 0x0032,
+    0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0C52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014,
+    0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0074, 0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0074, 0x0032,
+    0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0034,
+    0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0034, 0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0034, 0x0C52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014,
+    0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013,
+    0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2,
+    0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52,
+    0x0013, 0x03D0, 0x0292, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0032, 0x0014, 0x00B2, 0x0054,
+    0x0112, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0094, 0x0032, 0x0054, 0x0072, 0x0014, 0x0072, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0292, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0032,
+    0x0014, 0x00B2, 0x0054, 0x0112, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0072, 0x0014, 0x0072, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2,
+    0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993, 0x0460, 0x1973, 0x7C50,
+    0x1972, 0x0460, 0x1992, 0x0240, 0x01F0, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2,
+    0x0003, 0x03E0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032, 0x0074, 0x01D2, 0x0014,
+    0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0094, 0x0012, 0x0094,
+    0x0012, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032,
+    0x0074, 0x01D2, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032,
+    0x0094, 0x0012, 0x0094, 0x0012, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01D2, 0x0014, 0x0112, 0x0034,
+    0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013,
+    0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x01D2, 0x0014, 0x0112, 0x0034, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01F2, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01F2, 0x0014, 0x00F2, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x00F2, 0x0094, 0x0092, 0x0014, 0x00D2, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014,
+    0x0052, 0x0074, 0x0032, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x00F2, 0x0094, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052,
+    0x0074, 0x0032, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0272, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0094, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014,
+    0x0E12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0272, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0094, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0E12, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0252, 0x0014,
+    0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0032, 0x0014, 0x0DF2, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0252, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0032, 0x0014, 0x0DF2, 0x0013, 0x03D0, 0x0292, 0x0054,
+    0x0032, 0x0074, 0x0032, 0x0014, 0x0232, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0DD2, 0x0013, 0x03D0, 0x0292, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0232, 0x0014, 0x0132,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052,
+    0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2,
+    0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0210, 0x0220, 0x1993, 0x0460, 0x1973,
+    0xFFF0, 0x6C50, 0x19B3, 0x0420, 0x19D3, 0x0400, 0x19F3, 0x03E0, 0x1A13, 0x03C0, 0x1A33, 0x03B0,
+    0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0041, 0x0003, 0x0041, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0013, 0x0021, 0x0013, 0x0031, 0x0013, 0x0001, 0x0023, 0x0001, 0x0073, 0x0021, 0x0013, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0041, 0x0013, 0x0021, 0x0403, 0x0035, 0x0033, 0x0005, 0x0033, 0x0025,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x00C3, 0x0005, 0x0023, 0x0005, 0x0003, 0x0045, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0013, 0x0001,
+    0x0093, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001,
+    0x03F3, 0x0005, 0x0023, 0x0005, 0x0013, 0x0005, 0x0003, 0x0005, 0x0013, 0x0005, 0x0023, 0x0005,
+    0x0003, 0x0005, 0x0013, 0x0005, 0x00D3, 0x0015, 0x0003, 0x0015, 0x0003, 0x0005, 0x0043, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0011, 0x0013, 0x0001,
+    0x0003, 0x0001, 0x0063, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x00A3, 0x0001, 0x0023, 0x0011,
+    0x0013, 0x0001, 0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x03B3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0003, 0x0005,
+    0x0043, 0x0005, 0x0083, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0043, 0x0015,
+    0x0013, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0003, 0x0031, 0x0033, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0031, 0x0013, 0x0011, 0x00B3, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0031, 0x0013, 0x0001, 0x0023, 0x0001, 0x03F3, 0x0035,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0015, 0x00F3, 0x0005, 0x0003, 0x0005,
+    0x0003, 0x0005, 0x0003, 0x0035, 0x0013, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0013, 0x0011, 0x0003, 0x0001, 0x0063, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x00A3, 0x0001, 0x0023, 0x0001, 0x0013, 0x0011,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x03B3, 0x0005, 0x0023, 0x0005,
+    0x0003, 0x0045, 0x0003, 0x0005, 0x0043, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0083, 0x0005,
+    0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0013, 0x0015, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0063, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001,
+    0x0013, 0x0001, 0x0013, 0x0001, 0x0013, 0x0001, 0x0093, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x03F3, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0013, 0x0005, 0x00D3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005,
+    0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0041, 0x0023, 0x0001, 0x0033, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0021, 0x0013, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0073, 0x0021, 0x0013, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0053, 0x0021, 0x0403, 0x0035,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x0013, 0x0025, 0x0013, 0x0005, 0x0023, 0x0005, 0x00C3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0045, 0x0003, 0x0005, 0x0023, 0x0005, 0x0013, 0x0025, 0x0D33, 0x01D0,
+    0x01D0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33,
+    0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x01D0,
+};
+
+static const uint16_t CHROME_PATTERNS_1_PAL[] = {0x0821, 0x1082, 0x3D8F, 0xFFFF, 0xBDF7, 0x04FF};
+static const uint16_t CHROME_PATTERNS_1[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0x61D0, 0x0011, 0x0DF2, 0x0011,
+    0x0F90, 0x0011, 0x0012, 0x0DF1, 0x0012, 0x0011, 0x0F60, 0x0001, 0x0012, 0x0E31, 0x0012, 0x0001,
+    0x0F40, 0x0001, 0x0002, 0x0E71, 0x0002, 0x0001, 0x0F20, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001,
+    0x0F10, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F00, 0x0001, 0x0002, 0x0EB1, 0x0002, 0x0001,
+    0x0EF0, 0x0001, 0x0002, 0x00C1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021,
+    0x00E3, 0x0021, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0541, 0x0002, 0x0001,
+    0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00E3,
+    0x0021, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00B3,
+    0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023,
+    0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x0023, 0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002,
+    0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0053,
+    0x0051, 0x0023, 0x0021, 0x0023, 0x05E1, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023,
+    0x0021, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x0021, 0x0053, 0x0051, 0x0023, 0x0021, 0x0023, 0x05E1, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0053, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x05E1, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023,
+    0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0051, 0x0023, 0x0051, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002,
+    0x0770, 0x0770, 0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1,
+    0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0051, 0x0023, 0x0051, 0x0023, 0x0081, 0x0023, 0x0021,
+    0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081,
+    0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0051, 0x0023, 0x0051,
+    0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1,
+    0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00E3, 0x0021,
+    0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0,
+    0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081,
+    0x00E3, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551,
+    0x0002, 0x0EF0, 0x0001, 0x0002, 0x00C1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0051, 0x0083, 0x0541, 0x0002, 0x0001, 0x0EF0, 0x0001, 0x0002, 0x0EB1, 0x0002, 0x0001, 0x0F00,
+    0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F10, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F20,
+    0x0001, 0x0002, 0x0E71, 0x0002, 0x0001, 0x0F40, 0x0001, 0x0012, 0x0E31, 0x0012, 0x0001, 0x0F60,
+    0x0011, 0x0012, 0x0DF1, 0x0012, 0x0011, 0x0F90, 0x0011, 0x0DF2, 0x0011, 0xFFF0, 0xABD0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0x0DF0, 0x3BF2, 0xF091, 0x0043, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0011, 0x0023, 0x0021, 0x0023, 0x0011, 0x0033, 0x0011, 0x0043, 0x0001, 0x0033, 0x0071, 0x0003,
+    0x0021, 0x0003, 0x00E1, 0x0003, 0x0101, 0x0003, 0x0101, 0x0004, 0x0081, 0x0042, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0001, 0x0042, 0x0001, 0x0042, 0x0001, 0x0032, 0x0081, 0x0022, 0x0081, 0x0012,
+    0x0101, 0x0002, 0x00A1, 0x0004, 0x0081, 0x0035, 0x0031, 0x0005, 0x0031, 0x0025, 0x0011, 0x0005,
+    0x0021, 0x0005, 0x0061, 0x0005, 0x0021, 0x0005, 0x01A1, 0x0004, 0x0D41, 0x0003, 0x0041, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0061, 0x0003, 0x0021, 0x0003,
+    0x0201, 0x0003, 0x0101, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0061, 0x0002,
+    0x0021, 0x0002, 0x0081, 0x0002, 0x0101, 0x0002, 0x00A1, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005,
+    0x0011, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005,
+    0x0071, 0x0015, 0x0001, 0x0015, 0x01A1, 0x0004, 0x0D41, 0x0003, 0x0041, 0x0013, 0x0011, 0x0003,
+    0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0041, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0013, 0x0011, 0x0003, 0x0011, 0x0013,
+    0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013, 0x0031, 0x0023, 0x0021, 0x0013, 0x0021, 0x0043,
+    0x0011, 0x0023, 0x0091, 0x0004, 0x0081, 0x0002, 0x0041, 0x0012, 0x0011, 0x0002, 0x0021, 0x0002,
+    0x0021, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0051, 0x0022,
+    0x0031, 0x0002, 0x0031, 0x0022, 0x0021, 0x0022, 0x0011, 0x0042, 0x0081, 0x0004, 0x0081, 0x0005,
+    0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0041, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0011, 0x0025, 0x0011, 0x0005,
+    0x0001, 0x0015, 0x0011, 0x0005, 0x0021, 0x0005, 0x0081, 0x0004, 0x0D41, 0x0033, 0x0011, 0x0003,
+    0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0033, 0x0011, 0x0033, 0x0071, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003,
+    0x0031, 0x0003, 0x0011, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0031, 0x0003, 0x0031, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0121, 0x0032, 0x0011, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0002, 0x0021, 0x0002, 0x0021, 0x0032, 0x0011, 0x0032, 0x0081, 0x0022,
+    0x0011, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0021, 0x0002, 0x0141, 0x0035, 0x0011, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0015, 0x0091, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005,
+    0x0001, 0x0015, 0x0011, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0DE1, 0x0003, 0x0041, 0x0003,
+    0x0011, 0x0013, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0001, 0x0003, 0x0041, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0011, 0x0023, 0x0011, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0011, 0x0023, 0x0031, 0x0003, 0x0021, 0x0043, 0x0081, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002,
+    0x0011, 0x0012, 0x0021, 0x0002, 0x0021, 0x0002, 0x0041, 0x0002, 0x0001, 0x0002, 0x0041, 0x0002,
+    0x0061, 0x0002, 0x0001, 0x0042, 0x0021, 0x0002, 0x0021, 0x0042, 0x0001, 0x0002, 0x0061, 0x0002,
+    0x00A1, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005, 0x0001, 0x0045, 0x0001, 0x0005, 0x0041, 0x0005,
+    0x0001, 0x0005, 0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0045,
+    0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0081, 0x0004, 0x0D41, 0x0003,
+    0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0011, 0x0003, 0x0071, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0011, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0031, 0x0003,
+    0x0031, 0x0013, 0x0001, 0x0003, 0x0001, 0x0003, 0x0011, 0x0003, 0x0031, 0x0003, 0x0001, 0x0003,
+    0x0001, 0x0003, 0x00C1, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002,
+    0x0021, 0x0002, 0x0041, 0x0002, 0x0011, 0x0002, 0x0071, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0061, 0x0002, 0x0021, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0081, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005, 0x0071, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0015, 0x0081, 0x0004, 0x0D41, 0x0043,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0011, 0x0023, 0x0021, 0x0023, 0x0011, 0x0033, 0x0011, 0x0043,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0061, 0x0003, 0x0021, 0x0003, 0x0011, 0x0033, 0x0021, 0x0003,
+    0x0031, 0x0023, 0x0051, 0x0003, 0x0011, 0x0033, 0x0031, 0x0003, 0x0021, 0x0023, 0x0091, 0x0004,
+    0x0081, 0x0042, 0x0001, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0042, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0071, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022,
+    0x0041, 0x0002, 0x0091, 0x0004, 0x0081, 0x0035, 0x0011, 0x0005, 0x0021, 0x0005, 0x0011, 0x0025,
+    0x0011, 0x0005, 0x0021, 0x0005, 0x0061, 0x0005, 0x0021, 0x0005, 0x0011, 0x0025, 0x0011, 0x0005,
+    0x0021, 0x0005, 0x0011, 0x0015, 0x0001, 0x0005, 0x0081, 0x0004, 0x0CA1, 0x0521, 0x0023, 0xEA91,
+};
+
+static const uint16_t CHROME_MENU_2_PAL[] = {0x780F, 0xFFFF, 0xF81F, 0x1006};
+static const uint16_t CHROME_MENU_2[] = {
+    0xFFF0, 0x3550, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x00F1, 0x0070,
+    0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070, 0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030,
+    0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070, 0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070,
+    0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070,
+    0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070, 0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030,
+    0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070, 0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070,
+    0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0070, 0x00B1, 0x0C10, 0x0950, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0071, 0x0070, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071,
+    0x0070, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071, 0x0070, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0130, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071, 0x0070, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x1530, 0x0031, 0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x1530, 0x0031, 0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031,
+    0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0070, 0x0031,
+    0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0131,
+    0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x1570, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x1570, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1,
+    0x1570, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1,
+    0x00B0, 0x00B1, 0xFFF0, 0x7410, 0x1DF2, 0x1DF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xEFF3,
+};
+
+static const uint16_t CHROME_SETTINGS_2_PAL[] = {0x1006, 0x780F, 0xF81F, 0xFFFF, 0x07FF};
+static const uint16_t CHROME_SETTINGS_2[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0x63B0, 0x0011, 0x0A32, 0x0011,
+    0x1350, 0x0011, 0x0012, 0x0A31, 0x0012, 0x0011, 0x1320, 0x0001, 0x0012, 0x0A71, 0x0012, 0x0001,
+    0x1300, 0x0001, 0x0002, 0x0AB1, 0x0002, 0x0001, 0x12E0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001,
+    0x12D0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12C0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001,
+    0x12B0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093,
+    0x0011, 0x0093, 0x0011, 0x0093, 0x0031, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073,
+    0x0031, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0093, 0x0031, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073, 0x0031, 0x0053,
+    0x0471, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0091, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013,
+    0x0091, 0x0013, 0x0051, 0x0033, 0x0031, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x04D1, 0x0002,
+    0x12B0, 0x0002, 0x00D1, 0x0013, 0x0091, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0033, 0x0031, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x04D1, 0x0002, 0x12B0, 0x0002,
+    0x00F1, 0x0053, 0x0031, 0x0073, 0x0071, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x00B1, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002,
+    0x00F1, 0x0053, 0x0031, 0x0073, 0x0071, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x00B1, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002,
+    0x0151, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0031, 0x0033, 0x0011, 0x0013, 0x0031, 0x0033, 0x0091, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002,
+    0x0151, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0031, 0x0033, 0x0011, 0x0013, 0x0031, 0x0033, 0x0091, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002,
+    0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013,
+    0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093,
+    0x0051, 0x0013, 0x0091, 0x0013, 0x0071, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073,
+    0x0031, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093, 0x0051, 0x0013,
+    0x0091, 0x0013, 0x0071, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073, 0x0031, 0x0053,
+    0x0471, 0x0002, 0x12B0, 0x0002, 0x0B11, 0x0002, 0x0950, 0x0950, 0x0002, 0x0B11, 0x0002, 0x12B0,
+    0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12B0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12C0,
+    0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12D0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12E0,
+    0x0001, 0x0002, 0x0AB1, 0x0002, 0x0001, 0x1300, 0x0001, 0x0012, 0x0A71, 0x0012, 0x0001, 0x1320,
+    0x0011, 0x0012, 0x0A31, 0x0012, 0x0011, 0x1350, 0x0011, 0x0A32, 0x0011, 0xFFF0, 0x91D0, 0x0BF1,
+    0x01B0, 0x0BF1, 0x0420, 0x0C11, 0x0190, 0x0C11, 0x0400, 0x0C31, 0x0170, 0x0C31, 0x03E0, 0x0C51,
+    0x0150, 0x0C51, 0x01E0, 0x01D0, 0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0,
+    0x0291, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130, 0x0271, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0,
+    0x0291, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130, 0x0271, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0,
+    0x0271, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033,
+    0x0591, 0x0130, 0x0271, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033,
+    0x0011, 0x0033, 0x0591, 0x0130, 0x0271, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x00B1, 0x0013, 0x0011, 0x0013, 0x0031, 0x0013,
+    0x00D1, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130,
+    0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0611, 0x03B0, 0x0271, 0x0013, 0x00B1, 0x0013,
+    0x0011, 0x0013, 0x0031, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013,
+    0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0611, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0073, 0x0031, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0093, 0x0011, 0x0073,
+    0x0031, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0073, 0x0051, 0x0053, 0x05B1, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0073, 0x0031, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0093, 0x0011, 0x0073,
+    0x0031, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0073, 0x0051, 0x0053, 0x05B1, 0x03B0,
+    0x02F1, 0x0013, 0x0051, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0111, 0x0013,
+    0x0591, 0x03B0, 0x02F1, 0x0013, 0x0051, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013,
+    0x0111, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130,
+    0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0091, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0093, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0, 0x0291, 0x0053,
+    0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0,
+    0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03C0,
+    0x0C51, 0x0150, 0x0C51, 0x03E0, 0x0C31, 0x0170, 0x0C31, 0x0400, 0x0C11, 0x0190, 0x0C11, 0x0420,
+    0x0BF1, 0x01B0, 0x0BF1, 0x3E10, 0x9840, 0x0021, 0x0B34, 0x0021, 0x1230, 0x0011, 0x0024, 0x0B31,
+    0x0024, 0x0011, 0x1200, 0x0001, 0x0014, 0x0B91, 0x0014, 0x0001, 0x11E0, 0x0001, 0x0004, 0x0BD1,
+    0x0004, 0x0001, 0x11C0, 0x0001, 0x0004, 0x0BF1, 0x0004, 0x0001, 0x11A0, 0x0001, 0x0004, 0x0C11,
+    0x0004, 0x0001, 0x1190, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C31,
+    0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31,
+    0x0004, 0x0001, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0034, 0x0011, 0x0004, 0x0041, 0x0044, 0x0011, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0001, 0x0014,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0041, 0x0004, 0x0061, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0011, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0034, 0x0011, 0x0004,
+    0x0041, 0x0034, 0x0021, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004, 0x00C1, 0x0004, 0x0001, 0x0044,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0041, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0041, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0044,
+    0x0001, 0x0044, 0x0011, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0081, 0x0044, 0x0001, 0x0034, 0x0011, 0x0044, 0x0001,
+    0x0044, 0x0061, 0x0034, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x08D1, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x00A1,
+    0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0001, 0x0014, 0x08D1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041,
+    0x0004, 0x00A1, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0891, 0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0011,
+    0x0034, 0x0011, 0x0034, 0x0011, 0x0034, 0x0071, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x08D1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041,
+    0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x00A1, 0x0004, 0x0001, 0x0004, 0x0021,
+    0x0044, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0891, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0041, 0x0004, 0x00A1,
+    0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x08D1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0001,
+    0x0044, 0x0061, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021,
+    0x0004, 0x08D1, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0001, 0x0034, 0x0021, 0x0024,
+    0x0021, 0x0024, 0x0021, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0014,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0034, 0x0011, 0x0034, 0x0021, 0x0024, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0021, 0x0004, 0x08F1, 0x0004,
+    0x1170, 0x0004, 0x0091, 0x0004, 0x0001, 0x0004, 0x0011, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x00A1, 0x0004, 0x0021, 0x0044, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0011, 0x0024, 0x0021, 0x0024, 0x0021, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0031, 0x0024, 0x0011, 0x0044, 0x0001, 0x0044,
+    0x0001, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0014, 0x0001, 0x0014, 0x0011, 0x0004,
+    0x0001, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0991, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004,
+    0x0021, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0024,
+    0x0031, 0x0004, 0x0021, 0x0034, 0x0011, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0044, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0041, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x09A1, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0081,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0024, 0x0031, 0x0004, 0x0021,
+    0x0044, 0x0001, 0x0004, 0x0021, 0x0004, 0x0991, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0031, 0x0004, 0x0021, 0x0044, 0x0001,
+    0x0044, 0x0001, 0x0044, 0x0001, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0081,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021,
+    0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0014, 0x0011, 0x0004, 0x0021, 0x0004, 0x08F1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0034, 0x0011, 0x0034, 0x0011, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0044, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021,
+    0x0004, 0x0041, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0014, 0x0021, 0x0004, 0x08F1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0044, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0034, 0x0011, 0x0044, 0x0011, 0x0024, 0x0011, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0044, 0x0991, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0014, 0x0001, 0x0014, 0x0001, 0x0004, 0x09D1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0034, 0x0031, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x09D1, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0011, 0x0004, 0x0061, 0x0004,
+    0x0031, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0991, 0x0004, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1190, 0x0001,
+    0x0004, 0x0C11, 0x0004, 0x0001, 0x11A0, 0x0001, 0x0004, 0x0BF1, 0x0004, 0x0001, 0x11C0, 0x0001,
+    0x0004, 0x0BD1, 0x0004, 0x0001, 0x11E0, 0x0001, 0x0014, 0x0B91, 0x0014, 0x0001, 0x1200, 0x0011,
+    0x0024, 0x0B31, 0x0024, 0x0011, 0x1230, 0x0021, 0x0B34, 0x0021, 0xA600, 0x9810, 0x0011, 0x0BB4,
+    0x0011, 0x11E0, 0x0001, 0x0014, 0x0BB1, 0x0014, 0x0001, 0x11C0, 0x0001, 0x0004, 0x0BF1, 0x0004,
+    0x0001, 0x11A0, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C31, 0x0004,
+    0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x11A0, 0x0001,
+    0x0004, 0x0BF1, 0x0004, 0x0001, 0x11C0, 0x0001, 0x0014, 0x0BB1, 0x0014, 0x0001, 0x11E0, 0x0011,
+    0x0BB4, 0x0011, 0xFFF0, 0xD1D0, 0xEFF0,
+};
+
+static const uint16_t CHROME_DIAGNOSTICS_2_PAL[] = {0x1006, 0x07FF, 0xA817, 0x780F, 0xFFFF, 0xDEFB};
+static const uint16_t CHROME_DIAGNOSTICS_2[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xBDF0, 0x0071, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0030, 0x0091, 0x0030, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0071, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0030, 0x0091, 0x0030, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0070, 0x0011, 0x0010, 0x0011, 0x0030, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0070, 0x0011, 0x0010, 0x0011,
+    0x0030, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0031, 0x0030, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x00D0, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011,
+    0x0090, 0x0011, 0x1650, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0090, 0x0031, 0x0030, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x00D0, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x1650, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0011, 0x0010, 0x0011,
+    0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0070, 0x0011, 0x0090, 0x0011,
+    0x0050, 0x0011, 0x00B0, 0x0051, 0x15F0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0030, 0x0051, 0x0070, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x00B0, 0x0051,
+    0x15F0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0091, 0x0010, 0x0011, 0x0030, 0x0031,
+    0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011,
+    0x0090, 0x0011, 0x0050, 0x0011, 0x0110, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0091, 0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0110, 0x0011,
+    0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x15D0, 0x0071, 0x0050, 0x0051, 0x0030, 0x0011, 0x0050, 0x0011,
+    0x0030, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051, 0x0070, 0x0011,
+    0x0070, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0071, 0x0050, 0x0051, 0x0030, 0x0011,
+    0x0050, 0x0011, 0x0030, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0xBFF0, 0xFFF0, 0x2E10, 0x1972,
+    0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0,
+    0x0272, 0x0094, 0x0012, 0x0094, 0x0012, 0x0094, 0x00D2, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0032, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013,
+    0x03D0, 0x0272, 0x0094, 0x0012, 0x0094, 0x0012, 0x0094, 0x00D2, 0x0074, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F52,
+    0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00B2, 0x0014, 0x0012, 0x0014,
+    0x0032, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x00B2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0032, 0x0014, 0x0012, 0x0014, 0x0F72, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2,
+    0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0F72,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014,
+    0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0092, 0x0094, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0012,
+    0x0014, 0x0092, 0x0014, 0x0092, 0x0094, 0x0052, 0x0014, 0x0F92, 0x0013, 0x01F0, 0x01D0, 0x02B2,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0092,
+    0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014,
+    0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0092, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2,
+    0x0023, 0x03F0, 0x19B2, 0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993,
+    0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2,
+    0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0054, 0x0012, 0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014,
+    0x0172, 0x0014, 0x0052, 0x0054, 0x0072, 0x0014, 0x0132, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013,
+    0x03D0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012,
+    0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014, 0x0172, 0x0014, 0x0052,
+    0x0054, 0x0072, 0x0014, 0x0132, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x01F0, 0x01D0, 0x0272,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072,
+    0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0034, 0x0152, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0034, 0x0112, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0034, 0x0152, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0034, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132,
+    0x0014, 0x0072, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014,
+    0x0132, 0x0014, 0x0072, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014,
+    0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072,
+    0x0014, 0x0132, 0x0014, 0x0092, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0032, 0x0054, 0x0092,
+    0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014,
+    0x0072, 0x0014, 0x0132, 0x0014, 0x0092, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0032, 0x0054,
+    0x0092, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132, 0x0014, 0x00F2, 0x0014, 0x0052, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132, 0x0014, 0x00F2, 0x0014,
+    0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0072,
+    0x0014, 0x0152, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014, 0x0152, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x03D0, 0x02B2, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0112, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013,
+    0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2, 0x0033,
+    0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993, 0x0460, 0x1973, 0x7A30, 0x0210,
+    0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2, 0x0003,
+    0x03E0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012,
+    0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0132, 0x0014, 0x0092, 0x0054, 0x0032, 0x0014, 0x0B32, 0x0013, 0x03D0,
+    0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012, 0x0094,
+    0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052, 0x0054,
+    0x0052, 0x0054, 0x0132, 0x0014, 0x0092, 0x0054, 0x0032, 0x0014, 0x0B32, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072,
+    0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00F2, 0x0034, 0x0072, 0x0014, 0x00B2, 0x0014, 0x0B12, 0x0013, 0x03D0, 0x0272, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072, 0x0014,
+    0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0034, 0x0072, 0x0014, 0x00B2, 0x0014, 0x0B12, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0092, 0x0014, 0x00F2, 0x0014, 0x0072, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0AF2, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0092, 0x0014, 0x00F2, 0x0014,
+    0x0072, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014,
+    0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0054, 0x0112, 0x0014, 0x0092, 0x0054, 0x0052, 0x0074, 0x0012, 0x0094, 0x0052, 0x0014, 0x0052,
+    0x0074, 0x0092, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0054, 0x0112, 0x0014, 0x0092, 0x0054, 0x0052, 0x0074, 0x0012, 0x0094,
+    0x0052, 0x0014, 0x0052, 0x0074, 0x0092, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0172, 0x0014, 0x00F2,
+    0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0AF2,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094,
+    0x0012, 0x0014, 0x0172, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0072, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0192, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0B12, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0192, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0072, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0B12, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0032, 0x0094, 0x0132, 0x0014, 0x0052,
+    0x0054, 0x0032, 0x0054, 0x0132, 0x0054, 0x0052, 0x0054, 0x0052, 0x0014, 0x0B32, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0032, 0x0094, 0x0132, 0x0014, 0x0052, 0x0054,
+    0x0032, 0x0054, 0x0132, 0x0054, 0x0052, 0x0054, 0x0052, 0x0014, 0x0B32, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2,
+    0x0023, 0x03F0, 0x19B2, 0x0033, 0x01F0, 0x0200, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440,
+    0x1993, 0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400,
+    0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0074, 0x0052, 0x0054, 0x0032, 0x0094, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0074, 0x0D32,
+    0x0013, 0x03D0, 0x0272, 0x0074, 0x0052, 0x0054, 0x0032, 0x0094, 0x0052, 0x0014, 0x0052, 0x0074,
+    0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054,
+    0x0052, 0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0074, 0x0D32, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0034, 0x0032,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0034, 0x0032, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0074, 0x0032, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0072, 0x0014, 0x0112,
+    0x0074, 0x0032, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032, 0x0074, 0x0D32, 0x0013, 0x03D0,
+    0x0272, 0x0074, 0x0032, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0074, 0x0072, 0x0014, 0x0112, 0x0074, 0x0032, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074,
+    0x0032, 0x0074, 0x0D32, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0094, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0112,
+    0x0014, 0x0092, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0D52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0094,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0032, 0x0034,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0012, 0x0014, 0x0D52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0032, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0032, 0x0014, 0x0D32, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0032, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0032, 0x0014, 0x0D32, 0x0013, 0x01F0, 0x01D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054,
+    0x0072, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0112, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0074,
+    0x0032, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052,
+    0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0,
+    0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0,
+    0x19D2, 0x0023, 0x03F0, 0x19B2, 0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440,
+    0x1993, 0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400,
+    0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0094, 0x0052, 0x0014, 0x0132, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0032, 0x0094, 0x0032, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0094, 0x0052, 0x0014, 0x0132, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0032, 0x0094,
+    0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0212, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014,
+    0x0052, 0x0014, 0x00D2, 0x0014, 0x0212, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x01F0, 0x01D0, 0x0272, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0034, 0x0052, 0x0014, 0x00B2, 0x0034, 0x0112, 0x0014, 0x0092, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034,
+    0x0032, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0032, 0x0034, 0x0052,
+    0x0014, 0x00B2, 0x0034, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034, 0x0032,
+    0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0C52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014,
+    0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0074, 0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0074, 0x0032,
+    0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0034,
+    0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0034, 0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0034, 0x0C52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014,
+    0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013,
+    0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2,
+    0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52,
+    0x0013, 0x03D0, 0x0292, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0032, 0x0014, 0x00B2, 0x0054,
+    0x0112, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0094, 0x0032, 0x0054, 0x0072, 0x0014, 0x0072, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0292, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0032,
+    0x0014, 0x00B2, 0x0054, 0x0112, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0072, 0x0014, 0x0072, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2,
+    0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993, 0x0460, 0x1973, 0x7C50,
+    0x1972, 0x0460, 0x1992, 0x0240, 0x01F0, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2,
+    0x0003, 0x03E0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032, 0x0074, 0x01D2, 0x0014,
+    0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0094, 0x0012, 0x0094,
+    0x0012, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032,
+    0x0074, 0x01D2, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032,
+    0x0094, 0x0012, 0x0094, 0x0012, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01D2, 0x0014, 0x0112, 0x0034,
+    0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013,
+    0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x01D2, 0x0014, 0x0112, 0x0034, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01F2, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01F2, 0x0014, 0x00F2, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x00F2, 0x0094, 0x0092, 0x0014, 0x00D2, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014,
+    0x0052, 0x0074, 0x0032, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x00F2, 0x0094, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052,
+    0x0074, 0x0032, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0272, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0094, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014,
+    0x0E12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0272, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0094, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0E12, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0252, 0x0014,
+    0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0032, 0x0014, 0x0DF2, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0252, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0032, 0x0014, 0x0DF2, 0x0013, 0x03D0, 0x0292, 0x0054,
+    0x0032, 0x0074, 0x0032, 0x0014, 0x0232, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0DD2, 0x0013, 0x03D0, 0x0292, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0232, 0x0014, 0x0132,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052,
+    0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2,
+    0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0210, 0x0220, 0x1993, 0x0460, 0x1973,
+    0xFFF0, 0x6C50, 0x19B3, 0x0420, 0x19D3, 0x0400, 0x19F3, 0x03E0, 0x1A13, 0x03C0, 0x1A33, 0x03B0,
+    0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0041, 0x0003, 0x0041, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0013, 0x0021, 0x0013, 0x0031, 0x0013, 0x0001, 0x0023, 0x0001, 0x0073, 0x0021, 0x0013, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0041, 0x0013, 0x0021, 0x0403, 0x0035, 0x0033, 0x0005, 0x0033, 0x0025,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x00C3, 0x0005, 0x0023, 0x0005, 0x0003, 0x0045, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0013, 0x0001,
+    0x0093, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001,
+    0x03F3, 0x0005, 0x0023, 0x0005, 0x0013, 0x0005, 0x0003, 0x0005, 0x0013, 0x0005, 0x0023, 0x0005,
+    0x0003, 0x0005, 0x0013, 0x0005, 0x00D3, 0x0015, 0x0003, 0x0015, 0x0003, 0x0005, 0x0043, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0011, 0x0013, 0x0001,
+    0x0003, 0x0001, 0x0063, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x00A3, 0x0001, 0x0023, 0x0011,
+    0x0013, 0x0001, 0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x03B3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0003, 0x0005,
+    0x0043, 0x0005, 0x0083, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0043, 0x0015,
+    0x0013, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0003, 0x0031, 0x0033, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0031, 0x0013, 0x0011, 0x00B3, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0031, 0x0013, 0x0001, 0x0023, 0x0001, 0x03F3, 0x0035,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0015, 0x00F3, 0x0005, 0x0003, 0x0005,
+    0x0003, 0x0005, 0x0003, 0x0035, 0x0013, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0013, 0x0011, 0x0003, 0x0001, 0x0063, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x00A3, 0x0001, 0x0023, 0x0001, 0x0013, 0x0011,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x03B3, 0x0005, 0x0023, 0x0005,
+    0x0003, 0x0045, 0x0003, 0x0005, 0x0043, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0083, 0x0005,
+    0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0013, 0x0015, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0063, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001,
+    0x0013, 0x0001, 0x0013, 0x0001, 0x0013, 0x0001, 0x0093, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x03F3, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0013, 0x0005, 0x00D3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005,
+    0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0041, 0x0023, 0x0001, 0x0033, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0021, 0x0013, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0073, 0x0021, 0x0013, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0053, 0x0021, 0x0403, 0x0035,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x0013, 0x0025, 0x0013, 0x0005, 0x0023, 0x0005, 0x00C3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0045, 0x0003, 0x0005, 0x0023, 0x0005, 0x0013, 0x0025, 0x0D33, 0x01D0,
+    0x01D0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33,
+    0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x01D0,
+};
+
+static const uint16_t CHROME_PATTERNS_2_PAL[] = {0x1006, 0x780F, 0xF81F, 0xFFFF, 0xDEFB, 0x07FF};
+static const uint16_t CHROME_PATTERNS_2[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0x61D0, 0x0011, 0x0DF2, 0x0011,
+    0x0F90, 0x0011, 0x0012, 0x0DF1, 0x0012, 0x0011, 0x0F60, 0x0001, 0x0012, 0x0E31, 0x0012, 0x0001,
+    0x0F40, 0x0001, 0x0002, 0x0E71, 0x0002, 0x0001, 0x0F20, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001,
+    0x0F10, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F00, 0x0001, 0x0002, 0x0EB1, 0x0002, 0x0001,
+    0x0EF0, 0x0001, 0x0002, 0x00C1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021,
+    0x00E3, 0x0021, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0541, 0x0002, 0x0001,
+    0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00E3,
+    0x0021, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00B3,
+    0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023,
+    0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x0023, 0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002,
+    0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0053,
+    0x0051, 0x0023, 0x0021, 0x0023, 0x05E1, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023,
+    0x0021, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x0021, 0x0053, 0x0051, 0x0023, 0x0021, 0x0023, 0x05E1, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0053, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x05E1, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023,
+    0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0051, 0x0023, 0x0051, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002,
+    0x0770, 0x0770, 0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1,
+    0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0051, 0x0023, 0x0051, 0x0023, 0x0081, 0x0023, 0x0021,
+    0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081,
+    0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0051, 0x0023, 0x0051,
+    0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1,
+    0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00E3, 0x0021,
+    0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0,
+    0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081,
+    0x00E3, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551,
+    0x0002, 0x0EF0, 0x0001, 0x0002, 0x00C1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0051, 0x0083, 0x0541, 0x0002, 0x0001, 0x0EF0, 0x0001, 0x0002, 0x0EB1, 0x0002, 0x0001, 0x0F00,
+    0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F10, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F20,
+    0x0001, 0x0002, 0x0E71, 0x0002, 0x0001, 0x0F40, 0x0001, 0x0012, 0x0E31, 0x0012, 0x0001, 0x0F60,
+    0x0011, 0x0012, 0x0DF1, 0x0012, 0x0011, 0x0F90, 0x0011, 0x0DF2, 0x0011, 0xFFF0, 0xABD0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0x0DF0, 0x3BF2, 0xF091, 0x0043, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0011, 0x0023, 0x0021, 0x0023, 0x0011, 0x0033, 0x0011, 0x0043, 0x0001, 0x0033, 0x0071, 0x0003,
+    0x0021, 0x0003, 0x00E1, 0x0003, 0x0101, 0x0003, 0x0101, 0x0004, 0x0081, 0x0042, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0001, 0x0042, 0x0001, 0x0042, 0x0001, 0x0032, 0x0081, 0x0022, 0x0081, 0x0012,
+    0x0101, 0x0002, 0x00A1, 0x0004, 0x0081, 0x0035, 0x0031, 0x0005, 0x0031, 0x0025, 0x0011, 0x0005,
+    0x0021, 0x0005, 0x0061, 0x0005, 0x0021, 0x0005, 0x01A1, 0x0004, 0x0D41, 0x0003, 0x0041, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0061, 0x0003, 0x0021, 0x0003,
+    0x0201, 0x0003, 0x0101, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0061, 0x0002,
+    0x0021, 0x0002, 0x0081, 0x0002, 0x0101, 0x0002, 0x00A1, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005,
+    0x0011, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005,
+    0x0071, 0x0015, 0x0001, 0x0015, 0x01A1, 0x0004, 0x0D41, 0x0003, 0x0041, 0x0013, 0x0011, 0x0003,
+    0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0041, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0013, 0x0011, 0x0003, 0x0011, 0x0013,
+    0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013, 0x0031, 0x0023, 0x0021, 0x0013, 0x0021, 0x0043,
+    0x0011, 0x0023, 0x0091, 0x0004, 0x0081, 0x0002, 0x0041, 0x0012, 0x0011, 0x0002, 0x0021, 0x0002,
+    0x0021, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0051, 0x0022,
+    0x0031, 0x0002, 0x0031, 0x0022, 0x0021, 0x0022, 0x0011, 0x0042, 0x0081, 0x0004, 0x0081, 0x0005,
+    0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0041, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0011, 0x0025, 0x0011, 0x0005,
+    0x0001, 0x0015, 0x0011, 0x0005, 0x0021, 0x0005, 0x0081, 0x0004, 0x0D41, 0x0033, 0x0011, 0x0003,
+    0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0033, 0x0011, 0x0033, 0x0071, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003,
+    0x0031, 0x0003, 0x0011, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0031, 0x0003, 0x0031, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0121, 0x0032, 0x0011, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0002, 0x0021, 0x0002, 0x0021, 0x0032, 0x0011, 0x0032, 0x0081, 0x0022,
+    0x0011, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0021, 0x0002, 0x0141, 0x0035, 0x0011, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0015, 0x0091, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005,
+    0x0001, 0x0015, 0x0011, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0DE1, 0x0003, 0x0041, 0x0003,
+    0x0011, 0x0013, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0001, 0x0003, 0x0041, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0011, 0x0023, 0x0011, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0011, 0x0023, 0x0031, 0x0003, 0x0021, 0x0043, 0x0081, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002,
+    0x0011, 0x0012, 0x0021, 0x0002, 0x0021, 0x0002, 0x0041, 0x0002, 0x0001, 0x0002, 0x0041, 0x0002,
+    0x0061, 0x0002, 0x0001, 0x0042, 0x0021, 0x0002, 0x0021, 0x0042, 0x0001, 0x0002, 0x0061, 0x0002,
+    0x00A1, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005, 0x0001, 0x0045, 0x0001, 0x0005, 0x0041, 0x0005,
+    0x0001, 0x0005, 0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0045,
+    0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0081, 0x0004, 0x0D41, 0x0003,
+    0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0011, 0x0003, 0x0071, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0011, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0031, 0x0003,
+    0x0031, 0x0013, 0x0001, 0x0003, 0x0001, 0x0003, 0x0011, 0x0003, 0x0031, 0x0003, 0x0001, 0x0003,
+    0x0001, 0x0003, 0x00C1, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002,
+    0x0021, 0x0002, 0x0041, 0x0002, 0x0011, 0x0002, 0x0071, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0061, 0x0002, 0x0021, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0081, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005, 0x0071, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0015, 0x0081, 0x0004, 0x0D41, 0x0043,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0011, 0x0023, 0x0021, 0x0023, 0x0011, 0x0033, 0x0011, 0x0043,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0061, 0x0003, 0x0021, 0x0003, 0x0011, 0x0033, 0x0021, 0x0003,
+    0x0031, 0x0023, 0x0051, 0x0003, 0x0011, 0x0033, 0x0031, 0x0003, 0x0021, 0x0023, 0x0091, 0x0004,
+    0x0081, 0x0042, 0x0001, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0042, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0071, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022,
+    0x0041, 0x0002, 0x0091, 0x0004, 0x0081, 0x0035, 0x0011, 0x0005, 0x0021, 0x0005, 0x0011, 0x0025,
+    0x0011, 0x0005, 0x0021, 0x0005, 0x0061, 0x0005, 0x0021, 0x0005, 0x0011, 0x0025, 0x0011, 0x0005,
+    0x0021, 0x0005, 0x0011, 0x0015, 0x0001, 0x0005, 0x0081, 0x0004, 0x0CA1, 0x0521, 0x0023, 0xEA91,
+};
+
+static const uint16_t CHROME_MENU_3_PAL[] = {0x0540, 0xFFFF, 0x07E0, 0x0420};
+static const uint16_t CHROME_MENU_3[] = {
+    0xFFF0, 0x3550, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x00F1, 0x0070, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0,
+    0x00B1, 0x1570, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530,
+    0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0,
+    0x0031, 0x0030, 0x0031, 0x0070, 0x0071, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x00F1, 0x0070,
+    0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070, 0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030,
+    0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070, 0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070,
+    0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070,
+    0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070, 0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030,
+    0x0031, 0x0070, 0x00B1, 0x1570, 0x00F1, 0x0070, 0x00F1, 0x0070, 0x0031, 0x00B0, 0x0031, 0x0070,
+    0x00B1, 0x0070, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0070, 0x00B1, 0x0C10, 0x0950, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0071, 0x0070, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071,
+    0x0070, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071, 0x0070, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0130, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0071, 0x0070, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x1530, 0x0031, 0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x1530, 0x0031, 0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031,
+    0x0070, 0x0031, 0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x0070, 0x0031,
+    0x0070, 0x0031, 0x0130, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0031, 0x00B0, 0x0031, 0x1530, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0131,
+    0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x1570, 0x0031, 0x00B0, 0x0031,
+    0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x1570, 0x0031,
+    0x00B0, 0x0031, 0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1, 0x00B0, 0x00B1,
+    0x1570, 0x0031, 0x00B0, 0x0031, 0x0030, 0x0131, 0x0030, 0x00F1, 0x00B0, 0x00B1, 0x00B0, 0x00B1,
+    0x00B0, 0x00B1, 0xFFF0, 0x7410, 0x1DF2, 0x1DF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3,
+    0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xFFF3, 0xFFF3, 0xFFF3, 0x0BF3, 0xEFF3,
+};
+
+static const uint16_t CHROME_SETTINGS_3_PAL[] = {0x0420, 0x0540, 0x07E0, 0xFFFF, 0x07FF};
+static const uint16_t CHROME_SETTINGS_3[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0x63B0, 0x0011, 0x0A32, 0x0011,
+    0x1350, 0x0011, 0x0012, 0x0A31, 0x0012, 0x0011, 0x1320, 0x0001, 0x0012, 0x0A71, 0x0012, 0x0001,
+    0x1300, 0x0001, 0x0002, 0x0AB1, 0x0002, 0x0001, 0x12E0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001,
+    0x12D0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12C0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001,
+    0x12B0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093,
+    0x0011, 0x0093, 0x0011, 0x0093, 0x0031, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073,
+    0x0031, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0093, 0x0031, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073, 0x0031, 0x0053,
+    0x0471, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0091, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013,
+    0x0091, 0x0013, 0x0051, 0x0033, 0x0031, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x04D1, 0x0002,
+    0x12B0, 0x0002, 0x00D1, 0x0013, 0x0091, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0033, 0x0031, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x04D1, 0x0002, 0x12B0, 0x0002,
+    0x00F1, 0x0053, 0x0031, 0x0073, 0x0071, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x00B1, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002,
+    0x00F1, 0x0053, 0x0031, 0x0073, 0x0071, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x00B1, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002,
+    0x0151, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0031, 0x0033, 0x0011, 0x0013, 0x0031, 0x0033, 0x0091, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002,
+    0x0151, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0031, 0x0033, 0x0011, 0x0013, 0x0031, 0x0033, 0x0091, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002,
+    0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013, 0x0091, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0451, 0x0002, 0x12B0, 0x0002, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x00D1, 0x0013,
+    0x0091, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0451, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093,
+    0x0051, 0x0013, 0x0091, 0x0013, 0x0071, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073,
+    0x0031, 0x0053, 0x0471, 0x0002, 0x12B0, 0x0002, 0x00F1, 0x0053, 0x0031, 0x0093, 0x0051, 0x0013,
+    0x0091, 0x0013, 0x0071, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0073, 0x0031, 0x0053,
+    0x0471, 0x0002, 0x12B0, 0x0002, 0x0B11, 0x0002, 0x0950, 0x0950, 0x0002, 0x0B11, 0x0002, 0x12B0,
+    0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12B0, 0x0001, 0x0002, 0x0AF1, 0x0002, 0x0001, 0x12C0,
+    0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12D0, 0x0001, 0x0002, 0x0AD1, 0x0002, 0x0001, 0x12E0,
+    0x0001, 0x0002, 0x0AB1, 0x0002, 0x0001, 0x1300, 0x0001, 0x0012, 0x0A71, 0x0012, 0x0001, 0x1320,
+    0x0011, 0x0012, 0x0A31, 0x0012, 0x0011, 0x1350, 0x0011, 0x0A32, 0x0011, 0xFFF0, 0x91D0, 0x0BF1,
+    0x01B0, 0x0BF1, 0x0420, 0x0C11, 0x0190, 0x0C11, 0x0400, 0x0C31, 0x0170, 0x0C31, 0x03E0, 0x0C51,
+    0x0150, 0x0C51, 0x01E0, 0x01D0, 0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0,
+    0x0291, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130, 0x0271, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0,
+    0x0291, 0x0053, 0x0031, 0x0013, 0x0051, 0x0013, 0x0031, 0x0053, 0x0031, 0x0093, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130, 0x0271, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0,
+    0x0271, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033,
+    0x0591, 0x0130, 0x0271, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033,
+    0x0011, 0x0033, 0x0591, 0x0130, 0x0271, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0033, 0x0011, 0x0033, 0x0011, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x00B1, 0x0013, 0x0011, 0x0013, 0x0031, 0x0013,
+    0x00D1, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130,
+    0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0611, 0x03B0, 0x0271, 0x0013, 0x00B1, 0x0013,
+    0x0011, 0x0013, 0x0031, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013,
+    0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0611, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0073, 0x0031, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0093, 0x0011, 0x0073,
+    0x0031, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0073, 0x0051, 0x0053, 0x05B1, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0073, 0x0031, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0093, 0x0011, 0x0073,
+    0x0031, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0073, 0x0051, 0x0053, 0x05B1, 0x03B0,
+    0x02F1, 0x0013, 0x0051, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013,
+    0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0111, 0x0013,
+    0x0591, 0x03B0, 0x02F1, 0x0013, 0x0051, 0x0013, 0x00D1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013, 0x0011, 0x0013,
+    0x0111, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x0130,
+    0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013,
+    0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x03B0, 0x0271, 0x0013, 0x0051, 0x0013,
+    0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0091, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013,
+    0x0091, 0x0013, 0x0051, 0x0013, 0x0011, 0x0013, 0x0091, 0x0013, 0x0051, 0x0013, 0x0591, 0x03B0,
+    0x0291, 0x0053, 0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0093, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093,
+    0x0011, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0, 0x0291, 0x0053,
+    0x0071, 0x0013, 0x0071, 0x0053, 0x0071, 0x0013, 0x0051, 0x0093, 0x0011, 0x0013, 0x0051, 0x0013,
+    0x0591, 0x0130, 0x02B1, 0x0013, 0x0051, 0x0013, 0x0051, 0x0013, 0x0011, 0x0093, 0x0011, 0x0013,
+    0x0051, 0x0013, 0x0011, 0x0093, 0x0031, 0x0053, 0x05B1, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0,
+    0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03B0, 0x0C71, 0x0130, 0x0C71, 0x03C0,
+    0x0C51, 0x0150, 0x0C51, 0x03E0, 0x0C31, 0x0170, 0x0C31, 0x0400, 0x0C11, 0x0190, 0x0C11, 0x0420,
+    0x0BF1, 0x01B0, 0x0BF1, 0x3E10, 0x9840, 0x0021, 0x0B34, 0x0021, 0x1230, 0x0011, 0x0024, 0x0B31,
+    0x0024, 0x0011, 0x1200, 0x0001, 0x0014, 0x0B91, 0x0014, 0x0001, 0x11E0, 0x0001, 0x0004, 0x0BD1,
+    0x0004, 0x0001, 0x11C0, 0x0001, 0x0004, 0x0BF1, 0x0004, 0x0001, 0x11A0, 0x0001, 0x0004, 0x0C11,
+    0x0004, 0x0001, 0x1190, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C31,
+    0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31,
+    0x0004, 0x0001, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0034, 0x0011, 0x0004, 0x0041, 0x0044, 0x0011, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0001, 0x0014,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0041, 0x0004, 0x0061, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0011, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0034, 0x0011, 0x0004,
+    0x0041, 0x0034, 0x0021, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004, 0x00C1, 0x0004, 0x0001, 0x0044,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0041, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0041, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0044,
+    0x0001, 0x0044, 0x0011, 0x0024, 0x0941, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0081, 0x0044, 0x0001, 0x0034, 0x0011, 0x0044, 0x0001,
+    0x0044, 0x0061, 0x0034, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x08D1, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x00A1,
+    0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0001, 0x0014, 0x08D1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041,
+    0x0004, 0x00A1, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0891, 0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0011,
+    0x0034, 0x0011, 0x0034, 0x0011, 0x0034, 0x0071, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x08D1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041,
+    0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x00A1, 0x0004, 0x0001, 0x0004, 0x0021,
+    0x0044, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0891, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0041, 0x0004, 0x00A1,
+    0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x08D1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0001,
+    0x0044, 0x0061, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021,
+    0x0004, 0x08D1, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0001, 0x0034, 0x0021, 0x0024,
+    0x0021, 0x0024, 0x0021, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0014,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x08F1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0034, 0x0011, 0x0034, 0x0021, 0x0024, 0x0031, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0011, 0x0014, 0x0021, 0x0004, 0x08F1, 0x0004,
+    0x1170, 0x0004, 0x0091, 0x0004, 0x0001, 0x0004, 0x0011, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004,
+    0x0011, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x00A1, 0x0004, 0x0021, 0x0044, 0x0001, 0x0004,
+    0x0021, 0x0004, 0x0011, 0x0024, 0x0021, 0x0024, 0x0021, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004,
+    0x0931, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0031, 0x0024, 0x0011, 0x0044, 0x0001, 0x0044,
+    0x0001, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0014, 0x0001, 0x0014, 0x0011, 0x0004,
+    0x0001, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0991, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004,
+    0x0021, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0024,
+    0x0031, 0x0004, 0x0021, 0x0034, 0x0011, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0044, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0041, 0x0004, 0x0001, 0x0004, 0x0041, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x09A1, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0081,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0024, 0x0031, 0x0004, 0x0021,
+    0x0044, 0x0001, 0x0004, 0x0021, 0x0004, 0x0991, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0031, 0x0004, 0x0021, 0x0044, 0x0001,
+    0x0044, 0x0001, 0x0044, 0x0001, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170,
+    0x0004, 0x0081, 0x0004, 0x0021, 0x0004, 0x0011, 0x0004, 0x0001, 0x0004, 0x0011, 0x0004, 0x0001,
+    0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0931, 0x0004, 0x1170, 0x0004, 0x0081,
+    0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021,
+    0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0014, 0x0011, 0x0004, 0x0021, 0x0004, 0x08F1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0034, 0x0011, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0034, 0x0011, 0x0034, 0x0011, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0044, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021,
+    0x0004, 0x0041, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0011, 0x0014, 0x0021, 0x0004, 0x08F1,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0011, 0x0004, 0x0011, 0x0004, 0x0021, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041,
+    0x0004, 0x0021, 0x0044, 0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0931,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51,
+    0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0034, 0x0011, 0x0044, 0x0011, 0x0024, 0x0011, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0044, 0x0991, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004,
+    0x0021, 0x0014, 0x0001, 0x0014, 0x0001, 0x0004, 0x09D1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004,
+    0x0081, 0x0004, 0x0021, 0x0004, 0x0001, 0x0034, 0x0031, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0001, 0x0034, 0x09A1, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0951, 0x0004, 0x1170, 0x0004, 0x0081, 0x0004,
+    0x0021, 0x0004, 0x0001, 0x0004, 0x0061, 0x0004, 0x0041, 0x0004, 0x0021, 0x0004, 0x0021, 0x0004,
+    0x0001, 0x0004, 0x09D1, 0x0004, 0x1170, 0x0004, 0x0091, 0x0024, 0x0011, 0x0004, 0x0061, 0x0004,
+    0x0031, 0x0024, 0x0011, 0x0004, 0x0021, 0x0004, 0x0001, 0x0044, 0x0991, 0x0004, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1190, 0x0001,
+    0x0004, 0x0C11, 0x0004, 0x0001, 0x11A0, 0x0001, 0x0004, 0x0BF1, 0x0004, 0x0001, 0x11C0, 0x0001,
+    0x0004, 0x0BD1, 0x0004, 0x0001, 0x11E0, 0x0001, 0x0014, 0x0B91, 0x0014, 0x0001, 0x1200, 0x0011,
+    0x0024, 0x0B31, 0x0024, 0x0011, 0x1230, 0x0021, 0x0B34, 0x0021, 0xA600, 0x9810, 0x0011, 0x0BB4,
+    0x0011, 0x11E0, 0x0001, 0x0014, 0x0BB1, 0x0014, 0x0001, 0x11C0, 0x0001, 0x0004, 0x0BF1, 0x0004,
+    0x0001, 0x11A0, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C31, 0x0004,
+    0x0001, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170,
+    0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x0F90, 0x01D0, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0004, 0x0C51, 0x0004,
+    0x1170, 0x0004, 0x0C51, 0x0004, 0x1170, 0x0001, 0x0004, 0x0C31, 0x0004, 0x0001, 0x1170, 0x0001,
+    0x0004, 0x0C31, 0x0004, 0x0001, 0x1180, 0x0001, 0x0004, 0x0C11, 0x0004, 0x0001, 0x11A0, 0x0001,
+    0x0004, 0x0BF1, 0x0004, 0x0001, 0x11C0, 0x0001, 0x0014, 0x0BB1, 0x0014, 0x0001, 0x11E0, 0x0011,
+    0x0BB4, 0x0011, 0xFFF0, 0xD1D0, 0xEFF0,
+};
+
+static const uint16_t CHROME_DIAGNOSTICS_3_PAL[] = {0x0420, 0x07FF, 0x2E86, 0x0540, 0xFFFF, 0xCE79};
+static const uint16_t CHROME_DIAGNOSTICS_3[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xBDF0, 0x0071, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0030, 0x0091, 0x0030, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0071, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0030, 0x0091, 0x0030, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0070, 0x0011, 0x0010, 0x0011, 0x0030, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0070, 0x0011, 0x0010, 0x0011,
+    0x0030, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0031, 0x0030, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x00D0, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011,
+    0x0090, 0x0011, 0x1650, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0090, 0x0031, 0x0030, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x00D0, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x1650, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0011, 0x0010, 0x0011,
+    0x0010, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0070, 0x0011, 0x0090, 0x0011,
+    0x0050, 0x0011, 0x00B0, 0x0051, 0x15F0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0090, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0030, 0x0051, 0x0070, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x00B0, 0x0051,
+    0x15F0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0091, 0x0010, 0x0011, 0x0030, 0x0031,
+    0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011,
+    0x0090, 0x0011, 0x0050, 0x0011, 0x0110, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0050, 0x0091, 0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011, 0x0030, 0x0031, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0110, 0x0011,
+    0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011,
+    0x0050, 0x0011, 0x15D0, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011, 0x0010, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011, 0x0090, 0x0011, 0x0050, 0x0011, 0x0050, 0x0011,
+    0x0010, 0x0011, 0x0050, 0x0011, 0x15D0, 0x0071, 0x0050, 0x0051, 0x0030, 0x0011, 0x0050, 0x0011,
+    0x0030, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051, 0x0070, 0x0011,
+    0x0070, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0x15F0, 0x0071, 0x0050, 0x0051, 0x0030, 0x0011,
+    0x0050, 0x0011, 0x0030, 0x0071, 0x0010, 0x0011, 0x0050, 0x0011, 0x0030, 0x0051, 0x0050, 0x0051,
+    0x0070, 0x0011, 0x0070, 0x0051, 0x0050, 0x0051, 0x0050, 0x0051, 0xBFF0, 0xFFF0, 0x2E10, 0x1972,
+    0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0,
+    0x0272, 0x0094, 0x0012, 0x0094, 0x0012, 0x0094, 0x00D2, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0032, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013,
+    0x03D0, 0x0272, 0x0094, 0x0012, 0x0094, 0x0012, 0x0094, 0x00D2, 0x0074, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F52,
+    0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00B2, 0x0014, 0x0012, 0x0014,
+    0x0032, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x00B2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0F52, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0032, 0x0014, 0x0012, 0x0014, 0x0F72, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2,
+    0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0F72,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014,
+    0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0092, 0x0094, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0012,
+    0x0014, 0x0092, 0x0014, 0x0092, 0x0094, 0x0052, 0x0014, 0x0F92, 0x0013, 0x01F0, 0x01D0, 0x02B2,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0092,
+    0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x02B2, 0x0014,
+    0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0074, 0x0052, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0092, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0F92, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2,
+    0x0023, 0x03F0, 0x19B2, 0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993,
+    0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2,
+    0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0054, 0x0012, 0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014,
+    0x0172, 0x0014, 0x0052, 0x0054, 0x0072, 0x0014, 0x0132, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013,
+    0x03D0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012,
+    0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014, 0x0172, 0x0014, 0x0052,
+    0x0054, 0x0072, 0x0014, 0x0132, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x01F0, 0x01D0, 0x0272,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072,
+    0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0034, 0x0152, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0034, 0x0112, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0034, 0x0152, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0034, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132,
+    0x0014, 0x0072, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014,
+    0x0132, 0x0014, 0x0072, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014,
+    0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0072,
+    0x0014, 0x0132, 0x0014, 0x0092, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0032, 0x0054, 0x0092,
+    0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014,
+    0x0072, 0x0014, 0x0132, 0x0014, 0x0092, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0032, 0x0054,
+    0x0092, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132, 0x0014, 0x00F2, 0x0014, 0x0052, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0052, 0x0014, 0x0132, 0x0014, 0x00F2, 0x0014,
+    0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0BB2, 0x0013, 0x03D0, 0x02B2,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0072,
+    0x0014, 0x0152, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0072, 0x0014, 0x0152, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0BD2, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x03D0, 0x02B2, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0112, 0x0054, 0x0052, 0x0014, 0x0BF2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013,
+    0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2, 0x0033,
+    0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993, 0x0460, 0x1973, 0x7A30, 0x0210,
+    0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2, 0x0003,
+    0x03E0, 0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012,
+    0x0094, 0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0132, 0x0014, 0x0092, 0x0054, 0x0032, 0x0014, 0x0B32, 0x0013, 0x03D0,
+    0x0272, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0054, 0x0012, 0x0094,
+    0x0032, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0152, 0x0014, 0x0052, 0x0054,
+    0x0052, 0x0054, 0x0132, 0x0014, 0x0092, 0x0054, 0x0032, 0x0014, 0x0B32, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072,
+    0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00F2, 0x0034, 0x0072, 0x0014, 0x00B2, 0x0014, 0x0B12, 0x0013, 0x03D0, 0x0272, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0034, 0x0012, 0x0034, 0x0032, 0x0034, 0x0072, 0x0014,
+    0x00F2, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0034, 0x0072, 0x0014, 0x00B2, 0x0014, 0x0B12, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0092, 0x0014, 0x00F2, 0x0014, 0x0072, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0AF2, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0092, 0x0014, 0x00F2, 0x0014,
+    0x0072, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x00F2, 0x0014,
+    0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0054, 0x0112, 0x0014, 0x0092, 0x0054, 0x0052, 0x0074, 0x0012, 0x0094, 0x0052, 0x0014, 0x0052,
+    0x0074, 0x0092, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0034, 0x0052, 0x0054, 0x0112, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0054, 0x0112, 0x0014, 0x0092, 0x0054, 0x0052, 0x0074, 0x0012, 0x0094,
+    0x0052, 0x0014, 0x0052, 0x0074, 0x0092, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0172, 0x0014, 0x00F2,
+    0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0AF2,
+    0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094,
+    0x0012, 0x0014, 0x0172, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0072, 0x0014, 0x0AF2, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0192, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0072, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0B12, 0x0013, 0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x00F2, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0192, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0072, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0B12, 0x0013,
+    0x03D0, 0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052,
+    0x0054, 0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0032, 0x0094, 0x0132, 0x0014, 0x0052,
+    0x0054, 0x0032, 0x0054, 0x0132, 0x0054, 0x0052, 0x0054, 0x0052, 0x0014, 0x0B32, 0x0013, 0x03D0,
+    0x02B2, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0052, 0x0054,
+    0x0052, 0x0054, 0x0112, 0x0014, 0x0012, 0x0014, 0x0032, 0x0094, 0x0132, 0x0014, 0x0052, 0x0054,
+    0x0032, 0x0054, 0x0132, 0x0054, 0x0052, 0x0054, 0x0052, 0x0014, 0x0B32, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2,
+    0x0023, 0x03F0, 0x19B2, 0x0033, 0x01F0, 0x0200, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440,
+    0x1993, 0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400,
+    0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0074, 0x0052, 0x0054, 0x0032, 0x0094, 0x0052,
+    0x0014, 0x0052, 0x0074, 0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0074, 0x0D32,
+    0x0013, 0x03D0, 0x0272, 0x0074, 0x0052, 0x0054, 0x0032, 0x0094, 0x0052, 0x0014, 0x0052, 0x0074,
+    0x0032, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054,
+    0x0052, 0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0074, 0x0D32, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0034, 0x0032,
+    0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0014, 0x0012, 0x0014, 0x00F2, 0x0014, 0x0092, 0x0034, 0x0032, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0074, 0x0032, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0072, 0x0014, 0x0112,
+    0x0074, 0x0032, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032, 0x0074, 0x0D32, 0x0013, 0x03D0,
+    0x0272, 0x0074, 0x0032, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0074, 0x0072, 0x0014, 0x0112, 0x0074, 0x0032, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074,
+    0x0032, 0x0074, 0x0D32, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0094, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0112,
+    0x0014, 0x0092, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0D52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0094,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0032, 0x0034,
+    0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x0012, 0x0014, 0x0D52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0032, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0032, 0x0014, 0x0D32, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0032, 0x0014, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014,
+    0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0032, 0x0014, 0x0D32, 0x0013, 0x01F0, 0x01D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054,
+    0x0072, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0112, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0074,
+    0x0032, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052,
+    0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0112, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0074, 0x0032, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0D12, 0x0013, 0x03D0,
+    0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0,
+    0x19D2, 0x0023, 0x03F0, 0x19B2, 0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440,
+    0x1993, 0x0460, 0x1973, 0x7C50, 0x1972, 0x0460, 0x1992, 0x0440, 0x19B2, 0x0420, 0x19D2, 0x0400,
+    0x19F2, 0x03F0, 0x19F2, 0x0003, 0x03E0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0094, 0x0052, 0x0014, 0x0132, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0032, 0x0094, 0x0032, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0094, 0x0052, 0x0014, 0x0132, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0032, 0x0094,
+    0x0032, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0212, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014,
+    0x0052, 0x0014, 0x00D2, 0x0014, 0x0212, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x01F0, 0x01D0, 0x0272, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0034, 0x0052, 0x0014, 0x00B2, 0x0034, 0x0112, 0x0014, 0x0092, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014,
+    0x0092, 0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034,
+    0x0032, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0032, 0x0034, 0x0052,
+    0x0014, 0x00B2, 0x0034, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034, 0x0032,
+    0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0034, 0x0032, 0x0014, 0x0C52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0074, 0x0072, 0x0014,
+    0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0074, 0x0032, 0x0014, 0x00D2, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0074, 0x0072, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0074, 0x0032,
+    0x0014, 0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014,
+    0x00D2, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0034,
+    0x0C52, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x00D2, 0x0014, 0x0112, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0034, 0x0012, 0x0014, 0x0032, 0x0034, 0x0012, 0x0014, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0032, 0x0034, 0x0C52, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2, 0x0014,
+    0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013,
+    0x03D0, 0x0272, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x00D2,
+    0x0014, 0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0C52,
+    0x0013, 0x03D0, 0x0292, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0032, 0x0014, 0x00B2, 0x0054,
+    0x0112, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0094, 0x0032, 0x0054, 0x0072, 0x0014, 0x0072, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014,
+    0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x0292, 0x0014, 0x0012, 0x0014, 0x0052, 0x0054, 0x0032,
+    0x0014, 0x00B2, 0x0054, 0x0112, 0x0054, 0x0052, 0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0094, 0x0032, 0x0054, 0x0072, 0x0014, 0x0072, 0x0054, 0x0052,
+    0x0054, 0x0032, 0x0014, 0x0052, 0x0014, 0x0C52, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2,
+    0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0440, 0x1993, 0x0460, 0x1973, 0x7C50,
+    0x1972, 0x0460, 0x1992, 0x0240, 0x01F0, 0x19B2, 0x0420, 0x19D2, 0x0400, 0x19F2, 0x03F0, 0x19F2,
+    0x0003, 0x03E0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032, 0x0074, 0x01D2, 0x0014,
+    0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032, 0x0094, 0x0012, 0x0094,
+    0x0012, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x0032,
+    0x0074, 0x01D2, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0072, 0x0054, 0x0032,
+    0x0094, 0x0012, 0x0094, 0x0012, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01D2, 0x0014, 0x0112, 0x0034,
+    0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013,
+    0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052,
+    0x0014, 0x01D2, 0x0014, 0x0112, 0x0034, 0x0012, 0x0034, 0x0032, 0x0014, 0x0012, 0x0014, 0x0032,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01F2, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052, 0x0014,
+    0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x01F2, 0x0014, 0x00F2, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x00D2, 0x0014, 0x0052,
+    0x0014, 0x0092, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014,
+    0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x00F2, 0x0094, 0x0092, 0x0014, 0x00D2, 0x0014,
+    0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014,
+    0x0052, 0x0074, 0x0032, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0074, 0x00F2, 0x0094, 0x0092, 0x0014, 0x00D2, 0x0014, 0x0012,
+    0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052,
+    0x0074, 0x0032, 0x0074, 0x0DF2, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0012, 0x0014, 0x0272, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014,
+    0x0012, 0x0094, 0x0092, 0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014,
+    0x0E12, 0x0013, 0x03D0, 0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012,
+    0x0014, 0x0272, 0x0014, 0x00F2, 0x0014, 0x0012, 0x0014, 0x0012, 0x0014, 0x0012, 0x0094, 0x0092,
+    0x0014, 0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0012, 0x0014, 0x0E12, 0x0013, 0x03D0,
+    0x0272, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0252, 0x0014,
+    0x0112, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0052, 0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0032, 0x0014, 0x0DF2, 0x0013, 0x03D0, 0x0272,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0252, 0x0014, 0x0112,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0052,
+    0x0014, 0x0052, 0x0014, 0x0092, 0x0014, 0x0032, 0x0014, 0x0DF2, 0x0013, 0x03D0, 0x0292, 0x0054,
+    0x0032, 0x0074, 0x0032, 0x0014, 0x0232, 0x0014, 0x0132, 0x0014, 0x0052, 0x0014, 0x0012, 0x0014,
+    0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052, 0x0094, 0x0012, 0x0014, 0x0052, 0x0014,
+    0x0DD2, 0x0013, 0x03D0, 0x0292, 0x0054, 0x0032, 0x0074, 0x0032, 0x0014, 0x0232, 0x0014, 0x0132,
+    0x0014, 0x0052, 0x0014, 0x0012, 0x0014, 0x0052, 0x0014, 0x0032, 0x0054, 0x0072, 0x0014, 0x0052,
+    0x0094, 0x0012, 0x0014, 0x0052, 0x0014, 0x0DD2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2,
+    0x0013, 0x03D0, 0x19F2, 0x0013, 0x03D0, 0x19F2, 0x0013, 0x03E0, 0x19D2, 0x0023, 0x03F0, 0x19B2,
+    0x0033, 0x0400, 0x1992, 0x0033, 0x0420, 0x1972, 0x0033, 0x0210, 0x0220, 0x1993, 0x0460, 0x1973,
+    0xFFF0, 0x6C50, 0x19B3, 0x0420, 0x19D3, 0x0400, 0x19F3, 0x03E0, 0x1A13, 0x03C0, 0x1A33, 0x03B0,
+    0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0041, 0x0003, 0x0041, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0013, 0x0021, 0x0013, 0x0031, 0x0013, 0x0001, 0x0023, 0x0001, 0x0073, 0x0021, 0x0013, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0041, 0x0013, 0x0021, 0x0403, 0x0035, 0x0033, 0x0005, 0x0033, 0x0025,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x00C3, 0x0005, 0x0023, 0x0005, 0x0003, 0x0045, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0013, 0x0001,
+    0x0093, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001,
+    0x03F3, 0x0005, 0x0023, 0x0005, 0x0013, 0x0005, 0x0003, 0x0005, 0x0013, 0x0005, 0x0023, 0x0005,
+    0x0003, 0x0005, 0x0013, 0x0005, 0x00D3, 0x0015, 0x0003, 0x0015, 0x0003, 0x0005, 0x0043, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0011, 0x0013, 0x0001,
+    0x0003, 0x0001, 0x0063, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x00A3, 0x0001, 0x0023, 0x0011,
+    0x0013, 0x0001, 0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x03B3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0003, 0x0005,
+    0x0043, 0x0005, 0x0083, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0043, 0x0015,
+    0x0013, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0003, 0x0031, 0x0033, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0031, 0x0013, 0x0011, 0x00B3, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0031, 0x0013, 0x0001, 0x0023, 0x0001, 0x03F3, 0x0035,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0015, 0x00F3, 0x0005, 0x0003, 0x0005,
+    0x0003, 0x0005, 0x0003, 0x0035, 0x0013, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0013, 0x0011, 0x0003, 0x0001, 0x0063, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x00A3, 0x0001, 0x0023, 0x0001, 0x0013, 0x0011,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001, 0x03B3, 0x0005, 0x0023, 0x0005,
+    0x0003, 0x0045, 0x0003, 0x0005, 0x0043, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0083, 0x0005,
+    0x0003, 0x0005, 0x0003, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0013, 0x0015, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0063, 0x0001,
+    0x0023, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001,
+    0x0013, 0x0001, 0x0013, 0x0001, 0x0013, 0x0001, 0x0093, 0x0001, 0x0023, 0x0001, 0x0023, 0x0001,
+    0x0003, 0x0001, 0x0043, 0x0001, 0x0023, 0x0001, 0x03F3, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0013, 0x0005, 0x00D3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0005, 0x0043, 0x0005, 0x0023, 0x0005, 0x0003, 0x0005, 0x0023, 0x0005,
+    0x0D23, 0x03B0, 0x00E3, 0x0001, 0x0023, 0x0001, 0x0003, 0x0041, 0x0023, 0x0001, 0x0033, 0x0001,
+    0x0003, 0x0001, 0x0023, 0x0021, 0x0013, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0023, 0x0001,
+    0x0073, 0x0021, 0x0013, 0x0001, 0x0023, 0x0001, 0x0003, 0x0001, 0x0053, 0x0021, 0x0403, 0x0035,
+    0x0013, 0x0005, 0x0023, 0x0005, 0x0013, 0x0025, 0x0013, 0x0005, 0x0023, 0x0005, 0x00C3, 0x0005,
+    0x0023, 0x0005, 0x0003, 0x0045, 0x0003, 0x0005, 0x0023, 0x0005, 0x0013, 0x0025, 0x0D33, 0x01D0,
+    0x01D0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x03B0, 0x1A33,
+    0x03B0, 0x1A33, 0x03B0, 0x1A33, 0x01D0,
+};
+
+static const uint16_t CHROME_PATTERNS_3_PAL[] = {0x0420, 0x0540, 0x07E0, 0xFFFF, 0xCE79, 0x07FF};
+static const uint16_t CHROME_PATTERNS_3[] = {
+    0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0x61D0, 0x0011, 0x0DF2, 0x0011,
+    0x0F90, 0x0011, 0x0012, 0x0DF1, 0x0012, 0x0011, 0x0F60, 0x0001, 0x0012, 0x0E31, 0x0012, 0x0001,
+    0x0F40, 0x0001, 0x0002, 0x0E71, 0x0002, 0x0001, 0x0F20, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001,
+    0x0F10, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F00, 0x0001, 0x0002, 0x0EB1, 0x0002, 0x0001,
+    0x0EF0, 0x0001, 0x0002, 0x00C1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021,
+    0x00E3, 0x0021, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0541, 0x0002, 0x0001,
+    0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00E3,
+    0x0021, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x00B3, 0x00B1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00E3, 0x0021, 0x00B3,
+    0x0051, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023,
+    0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x0023, 0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002,
+    0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023, 0x0051, 0x0023, 0x0021, 0x0023, 0x0051, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0053,
+    0x0051, 0x0023, 0x0021, 0x0023, 0x05E1, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x0081, 0x0023,
+    0x0021, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x0021, 0x0053, 0x0051, 0x0023, 0x0021, 0x0023, 0x05E1, 0x0002, 0x0EF0, 0x0002,
+    0x00D1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0021, 0x0053, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x05E1, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023, 0x0021, 0x0023, 0x0021, 0x0023,
+    0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023, 0x0081, 0x0023,
+    0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023, 0x0021, 0x0023,
+    0x0021, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x00B3, 0x0051, 0x0023,
+    0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00B3, 0x0051, 0x00B3, 0x0051, 0x0023,
+    0x0021, 0x0023, 0x0021, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x00E3, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0021, 0x0023,
+    0x0081, 0x0023, 0x0051, 0x0053, 0x00E1, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023,
+    0x0051, 0x0023, 0x0051, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002,
+    0x0770, 0x0770, 0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1,
+    0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0051, 0x0023, 0x0051, 0x0023, 0x0081, 0x0023, 0x0021,
+    0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081,
+    0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0051, 0x0023, 0x0051,
+    0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0521, 0x0002, 0x0EF0, 0x0002, 0x00D1,
+    0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081, 0x00E3, 0x0021,
+    0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551, 0x0002, 0x0EF0,
+    0x0002, 0x00D1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023, 0x00E1, 0x0023, 0x0081,
+    0x00E3, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023, 0x0051, 0x0083, 0x0551,
+    0x0002, 0x0EF0, 0x0001, 0x0002, 0x00C1, 0x0023, 0x00E1, 0x0023, 0x0081, 0x0023, 0x0081, 0x0023,
+    0x00E1, 0x0023, 0x0081, 0x00E3, 0x0021, 0x0023, 0x0081, 0x0023, 0x0021, 0x0023, 0x0081, 0x0023,
+    0x0051, 0x0083, 0x0541, 0x0002, 0x0001, 0x0EF0, 0x0001, 0x0002, 0x0EB1, 0x0002, 0x0001, 0x0F00,
+    0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F10, 0x0001, 0x0002, 0x0E91, 0x0002, 0x0001, 0x0F20,
+    0x0001, 0x0002, 0x0E71, 0x0002, 0x0001, 0x0F40, 0x0001, 0x0012, 0x0E31, 0x0012, 0x0001, 0x0F60,
+    0x0011, 0x0012, 0x0DF1, 0x0012, 0x0011, 0x0F90, 0x0011, 0x0DF2, 0x0011, 0xFFF0, 0xABD0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0,
+    0xFFF0, 0xFFF0, 0x0BF0, 0xFFF0, 0x0DF0, 0x3BF2, 0xF091, 0x0043, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0011, 0x0023, 0x0021, 0x0023, 0x0011, 0x0033, 0x0011, 0x0043, 0x0001, 0x0033, 0x0071, 0x0003,
+    0x0021, 0x0003, 0x00E1, 0x0003, 0x0101, 0x0003, 0x0101, 0x0004, 0x0081, 0x0042, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0001, 0x0042, 0x0001, 0x0042, 0x0001, 0x0032, 0x0081, 0x0022, 0x0081, 0x0012,
+    0x0101, 0x0002, 0x00A1, 0x0004, 0x0081, 0x0035, 0x0031, 0x0005, 0x0031, 0x0025, 0x0011, 0x0005,
+    0x0021, 0x0005, 0x0061, 0x0005, 0x0021, 0x0005, 0x01A1, 0x0004, 0x0D41, 0x0003, 0x0041, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0061, 0x0003, 0x0021, 0x0003,
+    0x0201, 0x0003, 0x0101, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0061, 0x0002,
+    0x0021, 0x0002, 0x0081, 0x0002, 0x0101, 0x0002, 0x00A1, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005,
+    0x0011, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005,
+    0x0071, 0x0015, 0x0001, 0x0015, 0x01A1, 0x0004, 0x0D41, 0x0003, 0x0041, 0x0013, 0x0011, 0x0003,
+    0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0041, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0013, 0x0011, 0x0003, 0x0011, 0x0013,
+    0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013, 0x0031, 0x0023, 0x0021, 0x0013, 0x0021, 0x0043,
+    0x0011, 0x0023, 0x0091, 0x0004, 0x0081, 0x0002, 0x0041, 0x0012, 0x0011, 0x0002, 0x0021, 0x0002,
+    0x0021, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0051, 0x0022,
+    0x0031, 0x0002, 0x0031, 0x0022, 0x0021, 0x0022, 0x0011, 0x0042, 0x0081, 0x0004, 0x0081, 0x0005,
+    0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0041, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0011, 0x0025, 0x0011, 0x0005,
+    0x0001, 0x0015, 0x0011, 0x0005, 0x0021, 0x0005, 0x0081, 0x0004, 0x0D41, 0x0033, 0x0011, 0x0003,
+    0x0001, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0033, 0x0011, 0x0033, 0x0071, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003,
+    0x0031, 0x0003, 0x0011, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0031, 0x0003, 0x0031, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0121, 0x0032, 0x0011, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0002, 0x0021, 0x0002, 0x0021, 0x0032, 0x0011, 0x0032, 0x0081, 0x0022,
+    0x0011, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0021, 0x0002, 0x0141, 0x0035, 0x0011, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0015, 0x0091, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005,
+    0x0001, 0x0015, 0x0011, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0DE1, 0x0003, 0x0041, 0x0003,
+    0x0011, 0x0013, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0001, 0x0003, 0x0041, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0011, 0x0023, 0x0011, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0021, 0x0003, 0x0011, 0x0013,
+    0x0011, 0x0023, 0x0031, 0x0003, 0x0021, 0x0043, 0x0081, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002,
+    0x0011, 0x0012, 0x0021, 0x0002, 0x0021, 0x0002, 0x0041, 0x0002, 0x0001, 0x0002, 0x0041, 0x0002,
+    0x0061, 0x0002, 0x0001, 0x0042, 0x0021, 0x0002, 0x0021, 0x0042, 0x0001, 0x0002, 0x0061, 0x0002,
+    0x00A1, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005, 0x0001, 0x0045, 0x0001, 0x0005, 0x0041, 0x0005,
+    0x0001, 0x0005, 0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0001, 0x0005, 0x0001, 0x0045,
+    0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0081, 0x0004, 0x0D41, 0x0003,
+    0x0041, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0021, 0x0003,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0041, 0x0003, 0x0011, 0x0003, 0x0071, 0x0003,
+    0x0021, 0x0003, 0x0001, 0x0003, 0x0011, 0x0003, 0x0021, 0x0003, 0x0001, 0x0003, 0x0031, 0x0003,
+    0x0031, 0x0013, 0x0001, 0x0003, 0x0001, 0x0003, 0x0011, 0x0003, 0x0031, 0x0003, 0x0001, 0x0003,
+    0x0001, 0x0003, 0x00C1, 0x0004, 0x0081, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002,
+    0x0021, 0x0002, 0x0041, 0x0002, 0x0011, 0x0002, 0x0071, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0061, 0x0002, 0x0021, 0x0002, 0x0041, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0001, 0x0002,
+    0x0081, 0x0004, 0x0081, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0005, 0x0071, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005,
+    0x0041, 0x0005, 0x0021, 0x0005, 0x0001, 0x0005, 0x0011, 0x0015, 0x0081, 0x0004, 0x0D41, 0x0043,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0011, 0x0023, 0x0021, 0x0023, 0x0011, 0x0033, 0x0011, 0x0043,
+    0x0001, 0x0003, 0x0021, 0x0003, 0x0061, 0x0003, 0x0021, 0x0003, 0x0011, 0x0033, 0x0021, 0x0003,
+    0x0031, 0x0023, 0x0051, 0x0003, 0x0011, 0x0033, 0x0031, 0x0003, 0x0021, 0x0023, 0x0091, 0x0004,
+    0x0081, 0x0042, 0x0001, 0x0002, 0x0021, 0x0002, 0x0021, 0x0002, 0x0021, 0x0042, 0x0001, 0x0002,
+    0x0021, 0x0002, 0x0071, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022, 0x0021, 0x0022,
+    0x0041, 0x0002, 0x0091, 0x0004, 0x0081, 0x0035, 0x0011, 0x0005, 0x0021, 0x0005, 0x0011, 0x0025,
+    0x0011, 0x0005, 0x0021, 0x0005, 0x0061, 0x0005, 0x0021, 0x0005, 0x0011, 0x0025, 0x0011, 0x0005,
+    0x0021, 0x0005, 0x0011, 0x0015, 0x0001, 0x0005, 0x0081, 0x0004, 0x0CA1, 0x0521, 0x0023, 0xEA91,
+};
+
+static const ChromeImage CHROME_IMAGES[CHROME_SCREENS][CHROME_THEMES] = {
+    {
+        {CHROME_MENU_0, CHROME_MENU_0_PAL, {0, 298, 534, 538, 542, 546, 550, 554, 558, 562, 566, 570, 574, 575}},
+        {CHROME_MENU_1, CHROME_MENU_1_PAL, {0, 298, 534, 538, 542, 546, 550, 554, 558, 562, 566, 570, 574, 575}},
+        {CHROME_MENU_2, CHROME_MENU_2_PAL, {0, 298, 534, 538, 542, 546, 550, 554, 558, 562, 566, 570, 574, 575}},
+        {CHROME_MENU_3, CHROME_MENU_3_PAL, {0, 298, 534, 538, 542, 546, 550, 554, 558, 562, 566, 570, 574, 575}},
+    },
+    {
+        {CHROME_SETTINGS_0, CHROME_SETTINGS_0_PAL, {0, 4, 8, 415, 483, 1072, 1319, 1576, 1953, 2226, 2457, 2552, 2608, 2609}},
+        {CHROME_SETTINGS_1, CHROME_SETTINGS_1_PAL, {0, 4, 8, 415, 483, 1072, 1319, 1576, 1953, 2226, 2457, 2552, 2608, 2609}},
+        {CHROME_SETTINGS_2, CHROME_SETTINGS_2_PAL, {0, 4, 8, 415, 483, 1072, 1319, 1576, 1953, 2226, 2457, 2552, 2608, 2609}},
+        {CHROME_SETTINGS_3, CHROME_SETTINGS_3_PAL, {0, 4, 8, 415, 483, 1072, 1319, 1576, 1953, 2226, 2457, 2552, 2608, 2609}},
+    },
+    {
+        {CHROME_DIAGNOSTICS_0, CHROME_DIAGNOSTICS_0_PAL, {0, 4, 8, 453, 766, 982, 1475, 2069, 2621, 2913, 3400, 3908, 4392, 4409}},
+        {CHROME_DIAGNOSTICS_1, CHROME_DIAGNOSTICS_1_PAL, {0, 4, 8, 453, 766, 982, 1475, 2069, 2621, 2913, 3400, 3908, 4392, 4409}},
+        {CHROME_DIAGNOSTICS_2, CHROME_DIAGNOSTICS_2_PAL, {0, 4, 8, 453, 766, 982, 1475, 2069, 2621, 2913, 3400, 3908, 4392, 4409}},
+        {CHROME_DIAGNOSTICS_3, CHROME_DIAGNOSTICS_3_PAL, {0, 4, 8, 453, 766, 982, 1475, 2069, 2621, 2913, 3400, 3908, 4392, 4409}},
+    },
+    {
+        {CHROME_PATTERNS_0, CHROME_PATTERNS_0_PAL, {0, 4, 8, 493, 671, 675, 679, 683, 687, 691, 695, 699, 1389, 1392}},
+        {CHROME_PATTERNS_1, CHROME_PATTERNS_1_PAL, {0, 4, 8, 493, 671, 675, 679, 683, 687, 691, 695, 699, 1389, 1392}},
+        {CHROME_PATTERNS_2, CHROME_PATTERNS_2_PAL, {0, 4, 8, 493, 671, 675, 679, 683, 687, 691, 695, 699, 1389, 1392}},
+        {CHROME_PATTERNS_3, CHROME_PATTERNS_3_PAL, {0, 4, 8, 493, 671, 675, 679, 683, 687, 691, 695, 699, 1389, 1392}},
+    },
+};
+
+// Total: 73072 bytes en flash
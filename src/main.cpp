@@ -1,9 +1,27 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
-#include <TM1638plus.h>
+#include <soc/gpio_struct.h>
 #include <WiFi.h>
 #include <WiFiUdp.h>
 #include <ArduinoJson.h>
+#if !defined(CHROME_RLE) || CHROME_RLE
+#include "chrome_rle.h"
+#endif
+#ifdef ESP_PLATFORM
+#include <esp_idf_version.h>
+#endif
+// ADC en modo continuo (DMA del ADC1) con el driver adc_digi del IDF 4.x (core Arduino
+// 2.x); con ADC_DMA=0 (host u otro IDF) se muestrea con analogRead en cada bloque
+#ifndef ADC_DMA
+#if defined(ESP_PLATFORM) && ESP_IDF_VERSION_MAJOR == 4
+#define ADC_DMA 1
+#else
+#define ADC_DMA 0
+#endif
+#endif
+#if ADC_DMA
+#include <driver/adc.h>
+#endif
 // #include <ESPAsyncWebServer.h>  // DESHABILITADO - No se usa en SLAVE
 // #include <LittleFS.h>  // DESHABILITADO - No se usa en SLAVE
 // #include <FS.h>  // DESHABILITADO - No se usa en SLAVE
@@ -51,6 +69,21 @@
 // Rotary Angle Potentiometer (3 pins)
 #define ROTARY_ANGLE_PIN 35
 
+// Muestreo continuo de la escalera de botones y el potenciómetro (ADC1 canales 6 y 7):
+// un bloque cada ADC_BLOCK_INTERVAL_US con la media de todas las muestras (sobremuestreo),
+// mediana de los últimos bloques e IIR. La escalera pasa por una sola máquina de estados
+// con antirrebote que genera pulsación, liberación, click y hold.
+#define ADC_BLOCK_INTERVAL_US  2000
+#define ADC_DMA_SAMPLE_HZ      20000   // Total de los dos canales (mínimo del ESP32)
+#define ADC_DMA_FRAME_BYTES    128
+#define ADC_POLL_OVERSAMPLE    4       // Lecturas por bloque sin DMA
+#define ADC_MEDIAN_TAPS        5
+#define ADC_IIR_SHIFT          2       // y += (x - y) / 4 por bloque
+#define LADDER_DEBOUNCE_MS     20      // Nivel estable antes de aceptar un cambio
+#define PLAY_STOP_HOLD_MS      400     // Mantener = FILL
+#define MUTE_HOLD_MS           1000    // Mantener = CLEAR del instrumento
+#define VOLUME_DEBOUNCE_MS     50      // Botón de modo de volumen pulsado antes de aceptarlo
+
 // Volume Toggle Button (pin 14)
 #define VOLUME_TOGGLE_BTN 14
 
@@ -68,6 +101,31 @@
 #define MAX_VOLUME 150  // Volumen máximo ampliado para mayor potencia
 #define MAX_SAMPLES 16  // Total de instrumentos disponibles
 
+// Velocity por step: niveles de 4 bits (2 steps por byte)
+#define STEP_VEL_MIN      1
+#define STEP_VEL_MAX      15
+#define STEP_VEL_DEFAULT  10
+#define STEP_VEL_ACCENT   15  // Nivel máximo = acento
+
+// Condiciones por step: 1 byte = tipo (bits 7-6) + parámetro (bits 5-0)
+#define COND_TYPE_ALWAYS  0   // Siempre suena
+#define COND_TYPE_PROB    1   // Probabilidad (param + 1) / 64
+#define COND_TYPE_EVERY   2   // Loop A de cada B: bits 0-2 = A-1, bits 3-5 = B-1
+#define COND_TYPE_FILL    3   // bit 0 = 0: solo en FILL, 1: solo fuera de FILL
+#define COND_MAKE(type, param) ((uint8_t)(((type) << 6) | ((param) & 0x3F)))
+#define COND_ALWAYS            COND_MAKE(COND_TYPE_ALWAYS, 0)
+#define COND_PROB_PCT(pct)     COND_MAKE(COND_TYPE_PROB, ((pct) * 64 / 100) - 1)
+#define COND_EVERY(a, b)       COND_MAKE(COND_TYPE_EVERY, (((b) - 1) << 3) | ((a) - 1))
+#define COND_FILL              COND_MAKE(COND_TYPE_FILL, 0)
+#define COND_NOT_FILL          COND_MAKE(COND_TYPE_FILL, 1)
+
+// Swing global y microtiming por step (en 1/96 de step)
+#define SWING_MIN        50   // 50% = recto
+#define SWING_MAX        75
+#define SWING_STEP       2
+#define MICRO_TICKS      96   // Resolución del microtiming por step
+#define MICRO_MAX        24   // ±24/96 = ±1/4 de step
+
 // ============================================
 // SISTEMA DE TEMAS VISUALES
 // ============================================
@@ -212,6 +270,9 @@ enum DisplayMode {
 // ============================================
 struct Pattern {
     bool steps[MAX_TRACKS][MAX_STEPS];
+    uint8_t velocity[MAX_TRACKS][MAX_STEPS / 2];  // Nibbles: step par = bits 0-3, impar = bits 4-7
+    uint8_t cond[MAX_TRACKS][MAX_STEPS];          // Condición por step (0 = siempre)
+    int8_t micro[MAX_STEPS];                      // Microtiming por step (1/96 de step, ±MICRO_MAX)
     bool muted[MAX_TRACKS];
     String name;
 };
@@ -242,8 +303,44 @@ struct DiagnosticInfo {
 // GLOBAL OBJECTS
 // ============================================
 TFT_eSPI tft = TFT_eSPI();
-TM1638plus tm1(TM1638_1_STB, TM1638_1_CLK, TM1638_1_DIO, true);
-TM1638plus tm2(TM1638_2_STB, TM1638_2_CLK, TM1638_2_DIO, true);
+
+// Los dos TM1638 comparten CLK y tienen DIO propio: el driver escribe los registros GPIO
+// y saca un bit de cada chip en el mismo ciclo de reloj (CLK y DIO en el banco 0 de
+// GPIO, los STB en el banco 1)
+#define TM_CLK_MASK     (1UL << TM1638_1_CLK)
+#define TM_DIO1_MASK    (1UL << TM1638_1_DIO)
+#define TM_DIO2_MASK    (1UL << TM1638_2_DIO)
+#define TM_DIO_MASK     (TM_DIO1_MASK | TM_DIO2_MASK)
+#define TM_STB1_MASK    (1UL << (TM1638_1_STB - 32))
+#define TM_STB2_MASK    (1UL << (TM1638_2_STB - 32))
+#define TM_CHIP_BOTH    3      // Bit 0 = chip 1, bit 1 = chip 2
+#define TM_HALF_BIT_NS  500    // CLK alto/bajo (TM1638: >= 400 ns, máx. 1 MHz)
+static_assert(TM1638_1_CLK == TM1638_2_CLK, "El driver doble necesita el CLK compartido");
+static_assert(TM1638_1_CLK < 32 && TM1638_1_DIO < 32 && TM1638_2_DIO < 32,
+              "CLK y DIO deben estar en el banco 0 de GPIO");
+static_assert(TM1638_1_STB >= 32 && TM1638_2_STB >= 32, "Los STB deben estar en el banco 1 de GPIO");
+uint32_t tmHalfBitCycles = 120;
+
+// Sombra de la RAM de display de cada TM1638 (16 bytes: par = segmentos del dígito,
+// impar = LED). Texto y LEDs se escriben en la sombra y solo viajan por el bus los bytes
+// que cambian; el bus es bit-bang, así que cada transacción evitada es CPU del loop.
+struct TMShadow {
+    uint8_t ram[16];           // Contenido del chip
+    uint8_t next[16];          // Contenido pedido
+    uint16_t known;            // Bit = byte con valor conocido en el chip
+    uint16_t dirty;            // Bit = byte de next pendiente de enviar
+};
+TMShadow tmShadow[2] = {};
+int tmFrameDepth = 0;          // > 0: escrituras acumuladas hasta cerrar el frame
+struct TMBusStats {
+    uint32_t writes;           // Ráfagas de escritura enviadas
+    uint32_t skipped;          // Escrituras que la sombra evitó
+    uint32_t reads;            // Lecturas de botones (los dos chips a la vez)
+    uint32_t busMicros;        // Tiempo con el bus ocupado
+    unsigned long windowStart;
+};
+TMBusStats tmBusStats = {0, 0, 0, 0, 0};
+#define TM_BUS_REPORT_MS  5000
 HardwareSerial dfplayerSerial(1);  // UART1 para DFPlayer (pines configurables)
 // RotaryEncoder encoder(ENCODER_CLK, ENCODER_DT, RotaryEncoder::LatchMode::TWO03);
 
@@ -261,10 +358,93 @@ int currentStep = 0;
 int sequencerPage = 0;  // 0 = instrumentos 1-8, 1 = instrumentos 9-16
 int tempo = DEFAULT_BPM;
 int volume = DEFAULT_VOLUME;
-unsigned long lastStepTime = 0;
+unsigned long lastStepTime = 0;      // Instante de rejilla (sin swing) del step actual
 unsigned long stepInterval = 0;
+int swingAmount = SWING_MIN;         // % de swing en los steps pares (2, 4, 6...)
+long stepTimingOffset[MAX_STEPS] = {0};  // ms sobre la rejilla: swing + microtiming (precalculado)
+bool recordSwingQuantize = true;     // Cuantizar la grabación a la rejilla con swing
 bool isPlaying = false;
 
+// Cambio de patrón cuantizado: se arma y se aplica al final del compás
+int pendingPattern = -1;             // -1 = ningún cambio armado
+bool pendingPatternFetched = false;  // Datos del patrón armado ya recibidos del MASTER
+int patternSwitchBars = 1;           // Compases a esperar: 1, 2 o 4
+int barsUntilSwitch = 0;             // Compases restantes hasta aplicar el cambio
+int patternCursor = 0;               // Patrón resaltado en SCREEN_PATTERNS
+
+// Reloj de steps y condiciones (mismo resultado en SURFACE y MASTER con la misma semilla)
+int clockPrevStep = -1;              // Último step procesado por el reloj (-1 = parado)
+uint32_t loopCount = 0;              // Compases completos desde el inicio del play
+uint32_t conditionSeed = 0x808;      // Semilla compartida con el MASTER
+bool fillActive = false;             // FILL mientras se mantiene PLAY/STOP
+uint16_t stepTrigMask = 0;           // Tracks que suenan en el step actual (bit = track)
+
+// Grabación en vivo (SCREEN_LIVE): pads con timestamp del muestreo de entrada
+#define PAD_SAMPLE_INTERVAL_US 2000  // Muestreo de pads fuera del tick de 16 ms
+#define PAD_EVENT_QUEUE_SIZE   16
+struct PadEvent {
+    uint8_t pad;
+    unsigned long time;  // millis() en el instante del muestreo
+};
+PadEvent padEventQueue[PAD_EVENT_QUEUE_SIZE];
+uint8_t padEventHead = 0;
+uint8_t padEventTail = 0;
+uint16_t sampledButtons = 0;
+bool recordMode = false;
+uint16_t recordBatch[MAX_TRACKS] = {0};  // Steps grabados pendientes de enviar (bit = step)
+int recordBatchPattern = -1;             // Patrón del lote pendiente (-1 = vacío)
+
+// Note repeat (SCREEN_LIVE): un pad mantenido se repite en la rejilla del reloj de steps.
+// La tarea TASK_NOTE_REPEAT se arma para la próxima repetición (tiempos en micros()).
+#define NOTE_REPEAT_RAMP_STEP  12    // Velocity por repetición con rampa
+enum RepeatRate {
+    REPEAT_1_8,
+    REPEAT_1_16,
+    REPEAT_1_32,
+    REPEAT_1_8T,
+    REPEAT_1_16T,
+    REPEAT_1_32T,
+    REPEAT_RATE_COUNT
+};
+struct RepeatRateInfo {
+    const char* name;
+    uint8_t num;               // Periodo = step (1/16) * num / den
+    uint8_t den;
+};
+const RepeatRateInfo REPEAT_RATES[REPEAT_RATE_COUNT] = {
+    {"1/8 ", 2, 1}, {"1/16", 1, 1}, {"1/32", 1, 2},
+    {"1/8T", 4, 3}, {"16T ", 2, 3}, {"32T ", 1, 3},
+};
+enum RepeatRamp {
+    RAMP_OFF,
+    RAMP_UP,                   // Crescendo desde 1/4 de la velocity
+    RAMP_DOWN,                 // Decae hasta 1/4 de la velocity
+    RAMP_COUNT
+};
+struct NoteRepeat {
+    bool active;
+    uint8_t count;             // Repeticiones ya enviadas
+    uint32_t anchorUs;         // Origen de la rejilla parado (pulsación)
+    uint32_t nextUs;           // Próxima repetición
+};
+NoteRepeat noteRepeat[16] = {};
+int repeatRate = REPEAT_1_16;
+int repeatRamp = RAMP_OFF;
+
+// Deshacer/rehacer: diario circular de ediciones de steps (tamaño fijo, sin heap)
+#define UNDO_JOURNAL_SIZE 32
+struct EditRecord {
+    uint8_t pattern;
+    uint8_t track;
+    uint16_t oldMask;  // bit = step
+    uint16_t newMask;
+};
+EditRecord undoJournal[UNDO_JOURNAL_SIZE];
+uint8_t undoHead = 0;    // Próxima posición de escritura
+uint8_t undoCount = 0;   // Registros que se pueden deshacer (detrás de undoHead)
+uint8_t redoCount = 0;   // Registros que se pueden rehacer (desde undoHead)
+bool muteComboUsed = false;  // MUTE + encoder usado: no hacer clear/mute al soltar
+
 // Servidor Web WiFi
 // Configuración WiFi - SLAVE se conecta al MASTER
 const char* ssid = "RED808";          // WiFi del MASTER
@@ -292,22 +472,216 @@ bool webServerEnabled = false;  // Siempre false en SLAVE
 
 int selectedTrack = 0;
 int selectedStep = 0;
+// Parámetro que edita el encoder con un step mantenido (click del encoder alterna)
+enum StepEditParam {
+    STEP_EDIT_VELOCITY,
+    STEP_EDIT_MICRO
+};
+StepEditParam stepEditParam = STEP_EDIT_VELOCITY;
+uint16_t stepHoldEdited = 0;  // Steps mantenidos editados (velocity/condición): no togglear al soltar
 int menuSelection = 0;
 
 bool needsFullRedraw = true;
 bool needsHeaderUpdate = false;
 bool needsGridUpdate = false;
+
+// Sombra del último estado dibujado de cada celda visible del grid (8 tracks x 16 steps)
+#define CELL_FLAG_VALID     0x01  // 0 = celda sin dibujar (fuerza repintado)
+#define CELL_FLAG_MUTED     0x04
+#define CELL_FLAG_COND      0x08
+struct CellShadow {
+    uint16_t color;
+    uint16_t border;
+    uint8_t flags;
+};
+CellShadow gridShadow[8][MAX_STEPS];
+int16_t labelShadow[8] = {-1, -1, -1, -1, -1, -1, -1, -1};  // track | muted | seleccionado
+uint32_t gridPixelsPushed = 0;       // Píxeles enviados al TFT en el último frame del grid
+uint32_t gridPixelsStepSum = 0;      // Acumulado por compás para el informe serie
+uint32_t gridPixelsStepFrames = 0;
+
+// Bandas off-screen (SEQUENCER): se compone una fila en un sprite mientras la anterior
+// se envía al TFT desde una tarea en el núcleo 0, así entradas y UDP siguen corriendo
+#ifndef USE_BAND_RENDER
+#define USE_BAND_RENDER  1     // 0 = dibujo directo (para comparar CPU por frame)
+#endif
+#define BAND_HEIGHT      26    // Una fila del grid (cellH + 2)
+#define BAND_MAX_RUNS    18    // Etiqueta + tramos de celdas contiguas
+struct BandJob {
+    uint8_t buf;               // Sprite que se envía
+    bool native;               // true = nativeBand[buf] (RGB666) en vez del sprite
+    int16_t y;                 // Fila de pantalla de la banda
+    int16_t h;
+    uint8_t runCount;          // Tramos horizontales a enviar
+    int16_t runX[BAND_MAX_RUNS];
+    int16_t runW[BAND_MAX_RUNS];
+};
+TFT_eSprite bandSprite[2] = {TFT_eSprite(&tft), TFT_eSprite(&tft)};
+SemaphoreHandle_t bandFree[2] = {NULL, NULL};
+QueueHandle_t bandQueue = NULL;
+bool bandRenderEnabled = false;      // Solo si hay RAM para los dos sprites
+uint8_t bandNext = 0;
+
+// Píxeles nativos del ILI9488: por SPI solo acepta 18 bits (3 bytes por píxel) y TFT_eSPI
+// convierte cada píxel RGB565 al enviar imágenes y sprites. Los tiles del grid y las bandas
+// de fila se guardan ya en RGB666 y se envían tal cual con writeBytes.
+#ifndef PIXEL_666
+#ifdef ILI9488_DRIVER
+#define PIXEL_666  1
+#else
+#define PIXEL_666  0
+#endif
+#endif
+#define NATIVE_BPP  3
+uint8_t* nativeBand[2] = {nullptr, nullptr};  // Filas del grid en RGB666, mismo turno que bandSprite
+bool nativeBandsReady = false;
+
+// Pantallas completas por franjas: cada franja de 480xBAND_HEIGHT se compone entera fuera
+// de pantalla (fondo, marco, texto) con un viewport desplazado y se envía una sola vez,
+// de arriba abajo y sin sobredibujado en el TFT
+#define STRIP_COUNT  ((320 + BAND_HEIGHT - 1) / BAND_HEIGHT)
+typedef void (*ScreenDrawFn)(TFT_eSPI& g);
+TFT_eSprite stripSprite = TFT_eSprite(&tft);   // Franja con envío síncrono si no hay bandas
+bool stripRenderEnabled = false;
+int stripTop = 0;                    // Filas de pantalla en composición [stripTop, stripBottom)
+int stripBottom = 320;
+uint32_t screenClockMs = 0;          // millis() fijado por pantalla: todas las franjas ven la misma hora
+
+// Fondo fijo de MENU/SETTINGS/DIAGNOSTICS/PATTERNS precalculado en flash (RLE por franja,
+// include/chrome_rle.h generado con test/host: make chrome). La franja se rellena
+// descomprimiendo y solo se dibuja encima la parte variable de la pantalla. Cada franja se
+// compara una vez, la primera vez que se usa, con lo que dibuja TFT_eSPI: si un solo píxel
+// difiere, esa pantalla y tema vuelven a dibujar el fondo con primitivas.
+#ifndef CHROME_RLE
+#define CHROME_RLE  1        // 0 = dibujar el fondo fijo con primitivas
+#endif
+enum ChromeScreen {
+    CHROME_NONE = -1,
+    CHROME_MENU,
+    CHROME_SETTINGS,
+    CHROME_DIAGNOSTICS,
+    CHROME_PATTERNS,
+    CHROME_COUNT
+};
+#if CHROME_RLE
+static_assert(CHROME_STRIP_HEIGHT == BAND_HEIGHT, "chrome_rle.h: regenerar con la altura de franja actual");
+static_assert(CHROME_THEMES == THEME_COUNT, "chrome_rle.h: regenerar con los temas actuales");
+static_assert(CHROME_SCREENS == CHROME_COUNT, "chrome_rle.h: regenerar con las pantallas actuales");
+#endif
+static_assert(STRIP_COUNT <= 16, "ChromeCheck::strips: una franja por bit");
+struct ChromeCheck {
+    uint16_t strips;      // Franjas ya comparadas con TFT_eSPI
+    bool mismatch;        // Alguna difiere: fondo con primitivas
+};
+ChromeCheck chromeCheck[CHROME_COUNT][THEME_COUNT];
+
+// Planificador de render: la pantalla se dibuja en trozos reanudables con un presupuesto
+// por frame; entradas y UDP se atienden antes en cada tick
+#define FRAME_BUDGET_US  6000
+struct RenderJob {
+    bool active;
+    bool full;         // Repintado completo de currentScreen
+    bool header;       // Solo header
+    bool grid;         // Solo filas del grid (SEQUENCER)
+    int next;          // Siguiente trozo
+    uint32_t frame;    // Frame en que empezó
+};
+struct RenderStats {
+    uint32_t frames;          // Frames con trabajo de render
+    uint32_t frameUsSum;
+    uint32_t frameUsMax;
+    uint32_t overBudget;      // Frames que superaron el presupuesto (un trozo indivisible)
+    uint32_t deferredFrames;  // Frames que dejaron trozos para el siguiente
+    uint32_t deferredChunks;  // Trozos ejecutados en un frame posterior al de inicio
+};
+RenderJob renderJob = {false, false, false, false, 0, 0};
+RenderStats renderStats = {0, 0, 0, 0, 0, 0};
+unsigned long frameBudgetUs = FRAME_BUDGET_US;
+uint32_t renderFrame = 0;
+
+// Widgets del header: cada uno posee una zona de la barra y guarda la clave del valor
+// dibujado; needsHeaderUpdate solo repinta los que cambiaron (las zonas cubren 480x48)
+enum HeaderWidgetId {
+    HDR_TITLE,       // R808 + nombre de pantalla
+    HDR_CONTEXT,     // Instrumento (SEQUENCER) / REC (LIVE)
+    HDR_TEMPO,       // BPM
+    HDR_PATTERN,     // Patrón (SEQUENCER)
+    HDR_SEQ_VOL,     // SEQ:xx%
+    HDR_PAD_VOL,     // PAD:xx%
+    HDR_PLAY,        // Icono Play/Stop
+    HDR_WIDGET_COUNT
+};
+struct HeaderWidget {
+    int16_t x, y, w, h;
+};
+const HeaderWidget HEADER_WIDGETS[HDR_WIDGET_COUNT] = {
+    {0, 0, 98, 48},
+    {98, 0, 140, 48},
+    {238, 0, 80, 48},
+    {318, 0, 50, 48},
+    {368, 0, 76, 22},
+    {368, 22, 76, 26},
+    {444, 0, 36, 48},
+};
+uint32_t headerWidgetKey[HDR_WIDGET_COUNT];
+bool headerWidgetsValid = false;     // false = el próximo header se dibuja entero
+
+// Atlas de tiles de celda: la forma (esquinas redondeadas, borde, marca) se rasteriza
+// una vez como mapa de índices; cada estado visual solo aporta una paleta de 4 colores
+#define TILE_W          27     // = cellW del grid
+#define TILE_H          24     // = cellH del grid
+#define TILE_PX_CORNER  0      // Fuera del redondeo: fondo del grid
+#define TILE_PX_FILL    1
+#define TILE_PX_BORDER  2
+#define TILE_PX_MARK    3      // Marca de step condicional
+uint8_t tileShape[TILE_W * TILE_H];
+uint16_t tileBuffer[TILE_W * TILE_H];  // Tile expandido (bytes ya en orden del TFT)
+uint8_t tileNative[TILE_W * TILE_H * NATIVE_BPP];  // Tile expandido en RGB666
+bool tileCacheReady = false;
+
+// Playhead como capa aparte: marca sobre la columna del step y dos carriles de 1 px en los
+// huecos a los lados de la columna, con un tramo por fila que dice si su trig suena en este
+// loop (condiciones, mute). Las celdas no cambian al avanzar; lo que hay debajo de la
+// capa se guarda al dibujarla y se repone al moverla (del marco del grid: el TFT no se lee)
+#define PLAYHEAD_MARK_Y   72     // Entre "Page x/2" y los números de step
+#define PLAYHEAD_MARK_H   4
+#define PLAYHEAD_RAIL_Y   90     // Primera fila de celdas (gridY + 2)
+#define PLAYHEAD_RAIL_H   206    // 8 filas de celdas con sus huecos
+int playheadDrawn = -1;          // Step con la capa en pantalla (-1 = ninguna)
+uint16_t playheadBacking[2][PLAYHEAD_RAIL_H];         // Bajo los carriles (bytes en orden del TFT)
+uint16_t playheadMarkBacking[TILE_W * PLAYHEAD_MARK_H];
+uint16_t playheadRailColor[8];   // Tramo del carril de cada fila: resultado del trig en este loop
 int lastDisplayedStep = -1;
 int lastToggledTrack = -1; // Track que cambió para actualizar solo su fila
 
-int lastEncoderPos = 0;
-
-// Rotary Encoder variables (sin biblioteca)
-volatile int encoderPos = 0;
-volatile bool encoderChanged = false;
+// Rotary Encoder (sin biblioteca): la ISR decodifica la cuadratura y mete cada detent con
+// su timestamp en un anillo sin bloqueos (un productor, un consumidor); handleEncoder()
+// lo vacía y acelera según el intervalo entre detents
+#define ENCODER_STEPS_PER_DETENT  2
+#define ENCODER_RING_SIZE         32      // Potencia de 2
+#define ENCODER_ACCEL_SLOW_US     60000   // Más lento: sin aceleración
+#define ENCODER_ACCEL_FAST_US     5000    // Más rápido: ENCODER_ACCEL_MAX por detent
+#define ENCODER_ACCEL_MAX         12
+#define BPM_PER_DETENT            1       // Tempo con encoder mantenido (antes de acelerar)
+struct EncoderEvent {
+    uint32_t time;             // micros() del detent
+    int8_t dir;                // +1 / -1
+};
+EncoderEvent encoderRing[ENCODER_RING_SIZE];
+uint8_t encoderHead = 0;       // Solo lo escribe la ISR
+uint8_t encoderTail = 0;       // Solo lo escribe el consumidor
+volatile uint32_t encoderOverflows = 0;
 static uint8_t encoderState = 0;
+static int8_t encoderSubSteps = 0;
 static const int8_t encoderStates[] = {0,-1,1,0,1,0,0,-1,-1,0,0,1,0,1,-1,0};
 
+struct EncoderDelta {
+    int detents;               // Detents sin acelerar (navegación)
+    int accelerated;           // Detents con aceleración (tempo)
+};
+uint32_t encoderLastDetentUs = 0;
+int encoderLastDir = 0;
+
 // Volume control - DUAL MODE (Sequencer / Live Pads)
 enum VolumeMode {
     VOL_SEQUENCER,
@@ -318,32 +692,155 @@ int sequencerVolume = DEFAULT_VOLUME;  // 75%
 int livePadsVolume = 100;  // 100% - más fuerte para tocar en vivo
 int lastSequencerVolume = DEFAULT_VOLUME;
 int lastLivePadsVolume = 100;
-unsigned long lastVolumeRead = 0;
 
 unsigned long ledOffTime[16] = {0};
 bool ledActive[16] = {false};
 
 int audioLevels[8] = {0};
 bool padPressed[16] = {false};  // Estado de pads presionados para efecto neón
-unsigned long padPressTime[16] = {0};  // Tiempo de presión para tremolo
-unsigned long lastVizUpdate = 0;
 
 DisplayMode currentDisplayMode = DISPLAY_BPM;
-unsigned long lastDisplayChange = 0;
 int lastInstrumentPlayed = -1;
-unsigned long instrumentDisplayTime = 0;
 
 // Debug analog buttons
-unsigned long lastButtonDebug = 0;
 int lastAdcValue = -1;
 
 // UDP connection state
 bool udpConnected = false;
-unsigned long lastUdpCheck = 0;
 const unsigned long UDP_CHECK_INTERVAL = 30000;  // 30 segundos entre intentos de reconexión
 
+// Planificador cooperativo (sin heap): cada subsistema es una tarea periódica o un plazo
+// único. loop() ejecuta las vencidas en el orden de la tabla y duerme hasta el próximo
+// plazo; la ISR del encoder lo despierta antes.
+#define INPUT_INTERVAL_MS      5      // Botones, encoder y controles
+#define NETWORK_INTERVAL_MS    5      // UDP del MASTER y asociación WiFi
+#define SEQUENCER_INTERVAL_MS  16     // En play además se despierta en cada step
+#define FRAME_INTERVAL_MS      16     // Render del TFT y texto de los TM1638
+#define VIZ_INTERVAL_MS        50
+#define VOLUME_INTERVAL_MS     100
+#define ADC_DEBUG_INTERVAL_MS  200
+#define INSTRUMENT_DISPLAY_MS  2000   // Instrumento / edición de step en el TM1638
+#define DISPLAY_CYCLE_MS       3000   // LIVE: alternar BPM / volumen sin actividad
+#define SCHED_MIN_SLEEP_US     1000   // Menos de un tick de FreeRTOS: espera activa
+#define SCHED_MAX_SLEEP_MS     100
+enum TaskId {
+    TASK_PADS,                 // Solo armada en LIVE
+    TASK_NOTE_REPEAT,          // Plazo: próxima repetición
+    TASK_ADC,
+    TASK_INPUT,
+    TASK_ADC_DEBUG,
+    TASK_VOLUME,
+    TASK_SEQUENCER,
+    TASK_NETWORK,
+    TASK_WIFI_RETRY,
+    TASK_VIZ,
+    TASK_DISPLAY_REVERT,       // Plazo: volver al BPM en el TM1638
+    TASK_DISPLAY_CYCLE,
+    TASK_FRAME,
+    TASK_LED_OFF,              // Plazo: primer LED que se apaga
+    TASK_STATS,
+    TASK_COUNT
+};
+struct TaskState {
+    bool armed;
+    uint32_t dueUs;            // micros() del próximo plazo
+    uint32_t runs;
+};
+TaskState taskState[TASK_COUNT] = {};
+struct SchedStats {
+    uint32_t wakes;            // Vueltas del loop con alguna tarea vencida
+    uint32_t runs;
+    uint32_t idleUs;           // Dormido o en espera activa
+    unsigned long windowStart;
+};
+SchedStats schedStats = {0, 0, 0, 0};
+#ifdef ESP_PLATFORM
+TaskHandle_t loopTaskHandle = NULL;
+#endif
+
+// Conexión WiFi en segundo plano: loop() consulta el estado sin bloquear
+enum WifiConnState {
+    WIFI_CONN_IDLE,
+    WIFI_CONN_PENDING
+};
+WifiConnState wifiConnState = WIFI_CONN_IDLE;
+unsigned long wifiConnStart = 0;
+const unsigned long WIFI_CONNECT_TIMEOUT = 15000;  // Igual que los 30 x 500 ms del modo bloqueante
+
+// Arranque rápido: menú interactivo en <1 s; WiFi y animaciones fuera del camino crítico.
+// Mantener BACK pulsado al encender fuerza el arranque completo (consola + espectro)
+#ifndef FAST_BOOT
+#define FAST_BOOT  1
+#endif
+#define BOOT_MAX_PHASES  12
+struct BootPhase {
+    const char* name;
+    uint32_t us;       // micros() al terminar la fase (desde el reset)
+};
+BootPhase bootPhases[BOOT_MAX_PHASES];
+uint8_t bootPhaseCount = 0;
+bool fastBoot = FAST_BOOT;
+bool bootReportPending = true;   // Informe cuando el primer frame del menú está en pantalla
+
+// Foto de las entradas del tick: se muestrean una vez al principio del loop y todos los
+// handlers leen niveles y flancos de aquí (un escaneo de los TM1638 y una conversión del
+// ADC de botones por tick, y la misma vista para todos)
+#define INPUT_PLAY_STOP   (1 << 0)
+#define INPUT_MUTE        (1 << 1)
+#define INPUT_BACK        (1 << 2)
+#define INPUT_ENCODER_SW  (1 << 3)
+struct InputSnapshot {
+    unsigned long time;        // millis() del muestreo
+    uint16_t buttons;          // S1-S16 pulsados (bit = botón)
+    uint16_t pressed;          // Flancos respecto a la foto anterior
+    uint16_t released;
+    int buttonAdc;             // ADC filtrado de la escalera PLAY/STOP, MUTE, BACK
+    uint8_t controls;          // INPUT_* pulsados
+    uint8_t controlsPressed;
+    uint8_t controlsReleased;
+    uint8_t controlsClicked;   // Escalera: soltado antes del hold
+    uint8_t controlsHeld;      // Escalera: hold alcanzado (una vez por pulsación)
+};
+InputSnapshot input = {};
+
+enum AdcInput {
+    ADC_IN_BUTTONS,
+    ADC_IN_POT,
+    ADC_IN_COUNT
+};
+struct AdcChannel {
+    uint8_t pin;
+    uint8_t channel;           // Canal del ADC1
+    uint32_t sum;              // Muestras del bloque en curso
+    uint16_t samples;
+    uint16_t window[ADC_MEDIAN_TAPS];
+    uint8_t filled;
+    uint8_t pos;
+    int32_t iir;               // Valor filtrado << 4
+    int value;                 // Valor filtrado (0-4095)
+};
+AdcChannel adcInputs[ADC_IN_COUNT] = {
+    {ANALOG_BUTTONS_PIN, 6},
+    {ROTARY_ANGLE_PIN, 7},
+};
+bool adcDmaRunning = false;
+
+// Máquina de estados de la escalera (un botón a la vez); los eventos se acumulan entre
+// ticks y sampleInputs() los pasa a la foto
+struct LadderState {
+    uint8_t stable;            // INPUT_* aceptado (0 = ninguno)
+    uint8_t candidate;         // Nivel leído esperando el antirrebote
+    unsigned long candidateSince;
+    unsigned long pressTime;
+    bool holdSent;
+    uint8_t pressed;           // Eventos pendientes (INPUT_*)
+    uint8_t released;
+    uint8_t clicked;           // Soltado antes del hold
+    uint8_t held;
+};
+LadderState ladder = {};
+
 // Variables para manejo de botones
-uint16_t lastButtonState = 0;
 unsigned long buttonPressTime[16] = {0};
 unsigned long lastRepeatTime[16] = {0};
 
@@ -415,8 +912,22 @@ const uint16_t instrumentColors[MAX_TRACKS] = {
 // ============================================
 void setupKits();
 void setupWiFiAndUDP();
+void startWiFiConnect();
+void pollWiFiConnect();
+void onMasterConnected(bool audioFeedback);
+void bootMark(const char* phase);
+void bootPause(unsigned long ms);
+void logBootPhases();
 void calculateStepInterval();
+void rebuildStepTimingTable();
+void changeSwing(int delta);
+void editStepMicroTiming(int step, int delta);
 void updateSequencer();
+void sampleInputs(unsigned long now);
+void encoderISR();
+EncoderDelta readEncoder();
+void setupAdcSampler();
+void pollAdcInputs();
 void handleButtons();
 void handleEncoder();
 void handleBackButton();
@@ -425,39 +936,144 @@ void handleMuteButton();
 void handleVolume();
 void debugAnalogButtons();
 void triggerDrum(int track);
+void sendTrigger(int track, int velocity);
+void armNoteRepeat(int pad, unsigned long pressTime);
+void serviceNoteRepeat();
+void changeRepeatRate(int delta);
+void cycleRepeatRamp();
+int liveVelocity();
+void samplePadInputs();
+void handleLivePadPress(int pad, unsigned long pressTime);
+int quantizeToStep(unsigned long pressTime);
+void recordPadHit(int track, unsigned long pressTime);
+void flushRecordBatch();
+void toggleRecordMode();
 void testButtonsOnBoot();
 void sendUDPCommand(const char* cmd);
 void sendUDPCommand(JsonDocument& doc);
 void receiveUDPData();
 void requestPatternFromMaster();
+void requestPatternFromMaster(int patternNum);
 void drawBootScreen();
 void drawConsoleBootScreen();
 void drawSpectrumAnimation();
 void drawMainMenu();
+void drawMainMenuTo(TFT_eSPI& g);
+void drawMainMenuChrome(TFT_eSPI& g);
+void drawMainMenuContent(TFT_eSPI& g);
 void drawMenuItems(int oldSelection, int newSelection);
 void drawLiveScreen();
+void drawLiveScreenTo(TFT_eSPI& g);
 void drawSequencerScreen();
+bool drawSequencerChunk(int chunk, bool full);
+void drawSequencerChrome(TFT_eSPI& g);
+void drawSequencerTo(TFT_eSPI& g);
+void prepareSequencerShadow();
+bool drawSettingsChunk(TFT_eSPI& g, int chunk);
+void drawSettingsTo(TFT_eSPI& g);
+void drawSettingsChrome(TFT_eSPI& g);
+void drawSettingsContent(TFT_eSPI& g);
+void drawSettingsPartChrome(TFT_eSPI& g, int part);
+void drawSettingsPartContent(TFT_eSPI& g, int part);
+void scheduleRender();
+void runRenderJob();
 void drawSettingsScreen();
 void drawDiagnosticsScreen();
+void drawDiagnosticsScreenTo(TFT_eSPI& g);
+void drawDiagnosticsChrome(TFT_eSPI& g);
+void drawDiagnosticsContent(TFT_eSPI& g);
 void drawPatternsScreen();
+void drawPatternsScreenTo(TFT_eSPI& g);
+void drawPatternsChrome(TFT_eSPI& g);
+void drawPatternsContent(TFT_eSPI& g);
 void drawSinglePattern(int patternIndex, bool isSelected);
+void drawSinglePatternTo(TFT_eSPI& g, int patternIndex, bool isSelected);
 void drawSyncingScreen();
 void drawHeader();
+void drawHeaderTo(TFT_eSPI& g, int oy);
+void drawHeaderWidget(TFT_eSPI& g, int widget, int oy);
+uint32_t headerWidgetState(int widget);
+void updateHeaderWidgets();
+void setupBandRenderer();
+void setupStripRenderer();
+bool composeScreenStrip(int strip, ScreenDrawFn draw, int chrome);
+void decodeChromeStrip(TFT_eSprite& band, int chrome, int strip);
+uint32_t checkChromeStrip(TFT_eSprite& band, int chrome, int strip);
+void setupTileCache();
+void benchmarkCellTiles();
+uint32_t drawGridCell(TFT_eSPI& g, int x, int y, int w, int h, const CellShadow& cell);
+uint32_t drawGridCellPrimitives(TFT_eSPI& g, int x, int y, int w, int h, const CellShadow& cell);
+uint32_t drawTrackLabel(TFT_eSPI& g, int x, int y, int w, int h, int t);
+uint32_t drawGridTile565(TFT_eSPI& g, int x, int y, const CellShadow& cell);
+void bandWaitIdle();
+uint32_t updatePlayheadOverlay();
+int playheadRailX(int s, int side);
+void drawPlayheadOverlay(TFT_eSPI& g, int s);
+void drawPlayheadRails(TFT_eSPI& g, int bandY);
+uint16_t playheadRailColorAt(int y);
+bool updatePlayheadTrigColors();
+void savePlayheadBacking(int s);
+void writeNativeBlock(int x, int y, int w, int h, const uint8_t* data, int stride);
+void expandTileNative(const CellShadow& cell);
+uint32_t composeNativeGridRow(int bandY, const CellShadow* cells, uint16_t dirty);
+uint32_t composeSpriteGridRow(int bandY, int t, bool labelDirty, const CellShadow* cells, uint16_t dirty);
 void drawLivePad(int padIndex, bool highlight);
 void updateTM1638Displays();
+void tmDisplayText(int board, const char* text);
+void tmShadowReset(int board);
+void tmBusBegin();
+void tmBrightness(uint8_t level);
+void tmClear();
+void tmFlush();
+void tmBeginFrame();
+void tmEndFrame();
+void reportTMBusStats();
 void updateStepLEDs();
 void updateStepLEDsForTrack(int track);
 void updateLEDFeedback();
 void updateAudioVisualization();
 void changeTempo(int delta);
 void changePattern(int delta);
+void queuePatternChange(int patternIndex);
+void applyPatternChange(int patternIndex);
+void cancelPendingPattern();
+void handleBarBoundary();
 void changeKit(int delta);
 void changeTheme(int delta);
 void toggleStep(int track, int step);
+void editStepVelocity(int track, int step, int delta);
+void cycleStepCondition(int track, int step);
+void evaluateStepConditions(int step);
+void setFillActive(bool active);
+void sendStepVelocityTrack(int patternNum, int track);
+uint16_t trackStepMask(const Pattern& pattern, int track);
+void journalEdit(int patternNum, int track, uint16_t oldMask, uint16_t newMask);
+void undoEdit();
+void redoEdit();
 void changeScreen(Screen newScreen);
 void showInstrumentOnTM1638(int track);
 void showBPMOnTM1638();
 void showVolumeOnTM1638();
+void revertInstrumentDisplay();
+void cycleLiveDisplay();
+void deferDisplayCycle();
+void armDisplayRevert();
+void armLedOff(int led, unsigned long offTime);
+void schedAt(int task, uint32_t dueUs);
+void schedAfter(int task, uint32_t delayUs);
+void schedBy(int task, uint32_t dueUs);
+void schedCancel(int task);
+void schedWakeFromISR();
+void schedStart();
+void runDueTasks();
+void schedSleep();
+void inputTask();
+void sequencerTask();
+void networkTask();
+void wifiRetryTask();
+void frameTask();
+void reportStats();
+void reportSchedStats();
 void setLED(int ledIndex, bool state);
 void setAllLEDs(uint16_t pattern);
 uint16_t readAllButtons();
@@ -465,27 +1081,358 @@ uint16_t readAllButtons();
 // ============================================
 // TM1638 HELPERS
 // ============================================
-void setLED(int ledIndex, bool state) {
-    if (ledIndex < 8) {
-        tm1.setLED(ledIndex, state ? 1 : 0);
+// Fuente ASCII de 7 segmentos (0x20-0x7E), la misma tabla que usa TM1638plus
+static const uint8_t TM_FONT[95] = {
+    0x00, 0x86, 0x22, 0x7E, 0x6D, 0xD2, 0x46, 0x20, 0x29, 0x0B, 0x21, 0x70, 0x10, 0x40, 0x80, 0x52,
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F, 0x09, 0x0D, 0x61, 0x48, 0x43, 0xD3,
+    0x5F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71, 0x3D, 0x76, 0x30, 0x1E, 0x75, 0x38, 0x15, 0x37, 0x3F,
+    0x73, 0x6B, 0x33, 0x6D, 0x78, 0x3E, 0x3E, 0x2A, 0x76, 0x6E, 0x5B, 0x39, 0x64, 0x0F, 0x23, 0x08,
+    0x02, 0x5F, 0x7C, 0x58, 0x5E, 0x7B, 0x71, 0x6F, 0x74, 0x10, 0x0C, 0x75, 0x30, 0x14, 0x54, 0x5C,
+    0x73, 0x67, 0x50, 0x6D, 0x78, 0x1C, 0x1C, 0x14, 0x76, 0x6E, 0x5B, 0x46, 0x30, 0x70, 0x01
+};
+
+// Espera activa con el contador de ciclos (delayMicroseconds no baja de 1 µs)
+static inline void tmWait(uint32_t cycles) {
+    uint32_t start = ESP.getCycleCount();
+    while (ESP.getCycleCount() - start < cycles) {}
+}
+
+static inline uint32_t tmStbMask(uint8_t chips) {
+    return ((chips & 1) ? TM_STB1_MASK : 0) | ((chips & 2) ? TM_STB2_MASK : 0);
+}
+
+// Niveles en reposo antes de activar las salidas (STB alto: ningún chip seleccionado).
+// DIO con pull-up en modo entrada: para leer teclas basta con soltar la salida.
+void tmBusBegin() {
+    GPIO.out1_w1ts.val = TM_STB1_MASK | TM_STB2_MASK;
+    GPIO.out_w1ts = TM_CLK_MASK | TM_DIO_MASK;
+    pinMode(TM1638_1_STB, OUTPUT);
+    pinMode(TM1638_2_STB, OUTPUT);
+    pinMode(TM1638_1_CLK, OUTPUT);
+    pinMode(TM1638_1_DIO, INPUT_PULLUP);
+    pinMode(TM1638_2_DIO, INPUT_PULLUP);
+    GPIO.enable_w1ts = TM_DIO_MASK;
+    tmHalfBitCycles = ESP.getCpuFreqMHz() * TM_HALF_BIT_NS / 1000;
+}
+
+static inline void tmStart(uint8_t chips) {
+    GPIO.out1_w1tc.val = tmStbMask(chips);
+    tmWait(tmHalfBitCycles);
+}
+
+// STB alto al menos 1 µs entre transacciones
+static inline void tmStop(uint8_t chips) {
+    tmWait(tmHalfBitCycles);
+    GPIO.out1_w1ts.val = tmStbMask(chips);
+    tmWait(tmHalfBitCycles * 2);
+}
+
+// Un byte por chip en los mismos 8 ciclos de reloj: LSB primero, DIO cambia con CLK bajo
+// y el chip lo lee en el flanco de subida. Un chip con STB alto ignora el reloj.
+static void tmShiftOut(uint8_t data1, uint8_t data2) {
+    for (int bit = 0; bit < 8; bit++) {
+        uint32_t high = (((data1 >> bit) & 1) ? TM_DIO1_MASK : 0) |
+                        (((data2 >> bit) & 1) ? TM_DIO2_MASK : 0);
+        GPIO.out_w1tc = TM_CLK_MASK | (TM_DIO_MASK & ~high);
+        GPIO.out_w1ts = high;
+        tmWait(tmHalfBitCycles);
+        GPIO.out_w1ts = TM_CLK_MASK;
+        tmWait(tmHalfBitCycles);
+    }
+}
+
+static void tmCommand(uint8_t chips, uint8_t command) {
+    tmStart(chips);
+    tmShiftOut(command, command);
+    tmStop(chips);
+}
+
+void tmBrightness(uint8_t level) {
+    tmCommand(TM_CHIP_BOTH, 0x88 | (level & 7));  // Display encendido
+}
+
+// Ráfaga con dirección autoincremental: len bytes a cada chip seleccionado, cada uno
+// desde su dirección, en una sola transacción
+static void tmWriteBurst(uint8_t chips, uint8_t addr1, const uint8_t* data1,
+                         uint8_t addr2, const uint8_t* data2, int len) {
+    tmCommand(chips, 0x40);
+    tmStart(chips);
+    tmShiftOut(0xC0 | addr1, 0xC0 | addr2);
+    for (int i = 0; i < len; i++) {
+        tmShiftOut(data1[i], data2[i]);
+    }
+    tmStop(chips);
+}
+
+// Toda la RAM a 0 en los dos chips
+void tmClear() {
+    static const uint8_t zero[16] = {0};
+    tmWriteBurst(TM_CHIP_BOTH, 0, zero, 0, zero, 16);
+}
+
+// Teclado de los dos chips a la vez: tras el comando 0x42 cada chip saca sus 4 bytes por
+// su DIO (bit nuevo en el flanco de bajada) y se muestrean juntos con CLK alto
+static void tmReadKeys(uint8_t keys1[4], uint8_t keys2[4]) {
+    tmStart(TM_CHIP_BOTH);
+    tmShiftOut(0x42, 0x42);
+    GPIO.enable_w1tc = TM_DIO_MASK;
+    tmWait(tmHalfBitCycles * 2);  // Twait >= 1 µs antes del primer bit
+    for (int i = 0; i < 4; i++) {
+        uint8_t byte1 = 0;
+        uint8_t byte2 = 0;
+        for (int bit = 0; bit < 8; bit++) {
+            GPIO.out_w1tc = TM_CLK_MASK;
+            tmWait(tmHalfBitCycles);
+            GPIO.out_w1ts = TM_CLK_MASK;
+            tmWait(tmHalfBitCycles);
+            uint32_t in = GPIO.in;
+            if (in & TM_DIO1_MASK) byte1 |= 1 << bit;
+            if (in & TM_DIO2_MASK) byte2 |= 1 << bit;
+        }
+        keys1[i] = byte1;
+        keys2[i] = byte2;
+    }
+    tmStop(TM_CHIP_BOTH);
+    GPIO.out_w1ts = TM_DIO_MASK;
+    GPIO.enable_w1ts = TM_DIO_MASK;
+}
+
+// Tras tmClear() el chip tiene toda la RAM a 0
+void tmShadowReset(int board) {
+    TMShadow& shadow = tmShadow[board];
+    memset(shadow.ram, 0, sizeof(shadow.ram));
+    memset(shadow.next, 0, sizeof(shadow.next));
+    shadow.known = 0xFFFF;
+    shadow.dirty = 0;
+}
+
+// Enviar la imagen de cada chip en una ráfaga: el tramo de RAM que cubre todos los bytes
+// pendientes, con la misma longitud en los dos chips para que compartan el reloj (el chip
+// con menos cambios reenvía bytes que ya tiene)
+void tmFlush() {
+    uint8_t chips = (tmShadow[0].dirty ? 1 : 0) | (tmShadow[1].dirty ? 2 : 0);
+    if (!chips) return;
+    unsigned long start = micros();
+    int first[2] = {0, 0};
+    int len = 0;
+    for (int board = 0; board < 2; board++) {
+        uint16_t dirty = tmShadow[board].dirty;
+        if (!dirty) continue;
+        first[board] = __builtin_ctz(dirty);
+        len = max(len, 16 - __builtin_clz((uint32_t)dirty << 16) - first[board]);
+    }
+    for (int board = 0; board < 2; board++) {
+        TMShadow& shadow = tmShadow[board];
+        if (!(chips & (1 << board))) continue;
+        first[board] = min(first[board], 16 - len);
+        memcpy(shadow.ram + first[board], shadow.next + first[board], len);
+        shadow.known |= ((1 << len) - 1) << first[board];
+        shadow.dirty = 0;
+    }
+    tmWriteBurst(chips, first[0], tmShadow[0].next + first[0],
+                 first[1], tmShadow[1].next + first[1], len);
+    tmBusStats.writes++;
+    tmBusStats.busMicros += micros() - start;
+}
+
+// Frame de display: texto y LEDs se componen en la imagen de RAM de cada chip y salen
+// juntos al cerrar el frame más externo
+void tmBeginFrame() {
+    tmFrameDepth++;
+}
+
+void tmEndFrame() {
+    if (--tmFrameDepth == 0) tmFlush();
+}
+
+// Escribir un byte de la imagen de RAM; solo viaja si difiere de lo que tiene el chip
+void tmWriteRam(int board, uint8_t addr, uint8_t value) {
+    TMShadow& shadow = tmShadow[board];
+    uint16_t bit = 1 << addr;
+    shadow.next[addr] = value;
+    if ((shadow.known & bit) && shadow.ram[addr] == value) {
+        shadow.dirty &= ~bit;
+        tmBusStats.skipped++;
     } else {
-        tm2.setLED(ledIndex - 8, state ? 1 : 0);
+        shadow.dirty |= bit;
+    }
+    if (!tmFrameDepth) tmFlush();
+}
+
+// Como TM1638plus::displayText: un dígito por carácter ('.' se une al anterior) y solo
+// las posiciones que cubre el texto
+void tmDisplayText(int board, const char* text) {
+    int pos = 0;
+    char c;
+    tmBeginFrame();
+    while ((c = *text++) && pos < 8) {
+        uint8_t seg = (c >= 0x20 && c <= 0x7E) ? TM_FONT[c - 0x20] : 0;
+        if (*text == '.' && c != '.') {
+            seg |= 0x80;
+            text++;
+        }
+        tmWriteRam(board, pos << 1, seg);
+        pos++;
     }
+    tmEndFrame();
+}
+
+void setLED(int ledIndex, bool state) {
+    tmWriteRam(ledIndex >> 3, ((ledIndex & 7) << 1) | 1, state ? 1 : 0);
 }
 
 void setAllLEDs(uint16_t pattern) {
-    uint8_t low = pattern & 0xFF;
-    uint8_t high = (pattern >> 8) & 0xFF;
-    tm1.setLEDs(low);
-    tm2.setLEDs(high);
+    tmBeginFrame();
+    for (int i = 0; i < 16; i++) {
+        setLED(i, pattern & (1 << i));
+    }
+    tmEndFrame();
 }
 
+// Como TM1638plus::readButtons: el byte i aporta S(i+1) en el bit 0 y S(i+5) en el bit 4
 uint16_t readAllButtons() {
-    uint8_t btn1 = tm1.readButtons();
-    uint8_t btn2 = tm2.readButtons();
+    unsigned long start = micros();
+    uint8_t keys1[4];
+    uint8_t keys2[4];
+    tmReadKeys(keys1, keys2);
+    uint8_t btn1 = 0;
+    uint8_t btn2 = 0;
+    for (int i = 0; i < 4; i++) {
+        btn1 |= (uint8_t)(keys1[i] << i);
+        btn2 |= (uint8_t)(keys2[i] << i);
+    }
+    tmBusStats.reads++;
+    tmBusStats.busMicros += micros() - start;
     return btn1 | (btn2 << 8);
 }
 
+// Transacciones por segundo en el bus de los TM1638 (enviadas, evitadas, lecturas) y
+// tiempo de bus ocupado
+void reportTMBusStats() {
+    unsigned long now = millis();
+    unsigned long elapsed = now - tmBusStats.windowStart;
+    if (!elapsed) return;
+    Serial.printf("► TM1638: %lu writes/s, %lu skipped/s, %lu reads/s, bus %lu us/s\n",
+                 (unsigned long)(tmBusStats.writes * 1000UL / elapsed),
+                 (unsigned long)(tmBusStats.skipped * 1000UL / elapsed),
+                 (unsigned long)(tmBusStats.reads * 1000UL / elapsed),
+                 (unsigned long)(tmBusStats.busMicros * 1000UL / elapsed));
+    tmBusStats = {0, 0, 0, 0, now};
+}
+
+// ============================================
+// STEP VELOCITY (nibbles)
+// ============================================
+uint8_t getStepVelocity(const Pattern& pattern, int track, int step) {
+    uint8_t packed = pattern.velocity[track][step >> 1];
+    return (step & 1) ? (packed >> 4) : (packed & 0x0F);
+}
+
+void setStepVelocity(Pattern& pattern, int track, int step, uint8_t level) {
+    uint8_t& packed = pattern.velocity[track][step >> 1];
+    level &= 0x0F;
+    packed = (step & 1) ? ((packed & 0x0F) | (level << 4)) : ((packed & 0xF0) | level);
+}
+
+void resetStepVelocities(Pattern& pattern) {
+    memset(pattern.velocity, STEP_VEL_DEFAULT | (STEP_VEL_DEFAULT << 4), sizeof(pattern.velocity));
+}
+
+// Codificación compacta para UDP: un dígito hex por step ("AAAAFAAA...")
+void encodeVelocityTrack(const Pattern& pattern, int track, char* out) {
+    static const char hexDigits[] = "0123456789ABCDEF";
+    for (int s = 0; s < MAX_STEPS; s++) {
+        out[s] = hexDigits[getStepVelocity(pattern, track, s)];
+    }
+    out[MAX_STEPS] = '\0';
+}
+
+// Se valida el string entero antes de escribir: uno malo no deja el track a medias
+bool decodeVelocityTrack(Pattern& pattern, int track, const char* hex) {
+    if (!hex) return false;
+    uint8_t levels[MAX_STEPS];
+    for (int s = 0; s < MAX_STEPS; s++) {
+        char c = hex[s];
+        int level;
+        if (c >= '0' && c <= '9') level = c - '0';
+        else if (c >= 'A' && c <= 'F') level = c - 'A' + 10;
+        else if (c >= 'a' && c <= 'f') level = c - 'a' + 10;
+        else return false;    // También si el string tiene menos de MAX_STEPS dígitos
+        levels[s] = constrain(level, STEP_VEL_MIN, STEP_VEL_MAX);
+    }
+    for (int s = 0; s < MAX_STEPS; s++) {
+        setStepVelocity(pattern, track, s, levels[s]);
+    }
+    return true;
+}
+
+// ============================================
+// STEP CONDITIONS
+// ============================================
+struct StepConditionPreset {
+    uint8_t code;
+    const char* label;  // 8 caracteres para TM1638
+};
+
+const StepConditionPreset conditionPresets[] = {
+    {COND_ALWAYS,        "ALWAYS  "},
+    {COND_PROB_PCT(75),  "PROB 75%"},
+    {COND_PROB_PCT(50),  "PROB 50%"},
+    {COND_PROB_PCT(25),  "PROB 25%"},
+    {COND_EVERY(1, 2),   "LOOP 1-2"},
+    {COND_EVERY(2, 2),   "LOOP 2-2"},
+    {COND_EVERY(1, 4),   "LOOP 1-4"},
+    {COND_EVERY(4, 4),   "LOOP 4-4"},
+    {COND_FILL,          "FILL    "},
+    {COND_NOT_FILL,      "NO FILL "}
+};
+const int conditionPresetCount = sizeof(conditionPresets) / sizeof(conditionPresets[0]);
+
+// PRNG sin estado (hash de contador): el resultado solo depende de
+// (semilla, loop, track, step), no del orden ni del número de llamadas
+uint32_t conditionRandom(uint32_t seed, uint32_t loop, int track, int step) {
+    uint32_t x = seed ^ (loop * 0x9E3779B9u) ^ ((uint32_t)(track * MAX_STEPS + step) * 0x85EBCA6Bu);
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+bool evaluateCondition(uint8_t cond, int track, int step) {
+    uint8_t param = cond & 0x3F;
+    switch (cond >> 6) {
+        case COND_TYPE_PROB:
+            return (conditionRandom(conditionSeed, loopCount, track, step) & 0x3F) <= param;
+        case COND_TYPE_EVERY: {
+            uint32_t a = (param & 0x07) + 1;
+            uint32_t b = ((param >> 3) & 0x07) + 1;
+            return (loopCount % b) == (a - 1);
+        }
+        case COND_TYPE_FILL:
+            return (param & 1) ? !fillActive : fillActive;
+        default:
+            return true;
+    }
+}
+
+const char* conditionLabel(uint8_t cond) {
+    for (int i = 0; i < conditionPresetCount; i++) {
+        if (conditionPresets[i].code == cond) return conditionPresets[i].label;
+    }
+    return "COND    ";
+}
+
+// Escalar brillo de un color RGB565 según el nivel de velocity (35%-100%)
+uint16_t velocityColor(uint16_t color, uint8_t level) {
+    uint16_t scale = 90 + level * 11;  // 90..255
+    uint16_t r = (((color >> 11) & 0x1F) * scale) >> 8;
+    uint16_t g = (((color >> 5) & 0x3F) * scale) >> 8;
+    uint16_t b = ((color & 0x1F) * scale) >> 8;
+    return (r << 11) | (g << 5) | b;
+}
+
 uint16_t getInstrumentColor(int track) {
     if (track >= 0 && track < MAX_TRACKS) {
         return instrumentColors[track];
@@ -508,6 +1455,9 @@ void setupPatterns() {
     // Solo inicializar la estructura vacía
     for (int p = 0; p < MAX_PATTERNS; p++) {
         patterns[p].name = "PTN-" + String(p + 1);
+        resetStepVelocities(patterns[p]);
+        memset(patterns[p].cond, COND_ALWAYS, sizeof(patterns[p].cond));
+        memset(patterns[p].micro, 0, sizeof(patterns[p].micro));
         for (int t = 0; t < MAX_TRACKS; t++) {
             patterns[p].muted[t] = false;
             for (int s = 0; s < MAX_STEPS; s++) {
@@ -595,41 +1545,7 @@ void setupWiFiAndUDP() {
     }
     
     if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("\n✓ WiFi connected!");
-        Serial.print("  IP Address: ");
-        Serial.println(WiFi.localIP());
-        Serial.printf("  Signal strength: %d dBm\n", WiFi.RSSI());
-        Serial.printf("  MAC Address: %s\n", WiFi.macAddress().c_str());
-        
-        // PASO 3: Inicializar UDP y enviar hello
-        Serial.println("\n[3/3] Initializing UDP communication...");
-        udp.begin(udpPort);
-        udpConnected = true;
-        diagnostic.udpConnected = true;
-        
-        // Enviar hello al master
-        JsonDocument doc;
-        doc["cmd"] = "hello";
-        doc["device"] = "SURFACE";
-        sendUDPCommand(doc);
-        
-        Serial.println("✓ UDP initialized - Ready to send commands");
-        
-        // Sonido de confirmación al conectar: reproducir 3 samples rápidos
-        for (int i = 0; i < 3; i++) {
-            // Enviar comando para reproducir CLAP (sample 4)
-            JsonDocument triggerDoc;
-            triggerDoc["cmd"] = "trigger";
-            triggerDoc["track"] = 4;  // CLAP
-            sendUDPCommand(triggerDoc);
-            delay(100);
-        }
-        Serial.println("♪ Connection confirmed with audio feedback");
-        
-        // Solicitar patrón actual al MASTER automáticamente
-        delay(100);  // Dar tiempo al MASTER para procesar hello
-        requestPatternFromMaster();
-        Serial.println("► Auto-requesting pattern from MASTER...");
+        onMasterConnected(true);
     } else {
         Serial.println("\n✗ WiFi connection FAILED");
         Serial.printf("  Attempts: %d/%d (%.1f seconds)\n", attempts, maxAttempts, attempts * 0.5);
@@ -649,7 +1565,100 @@ void setupWiFiAndUDP() {
         udpConnected = false;
         diagnostic.udpConnected = false;
         diagnostic.lastError = masterFound ? "Connection timeout" : "Master not found";
-        lastUdpCheck = millis();  // Iniciar timer de reintento
+        schedAfter(TASK_WIFI_RETRY, UDP_CHECK_INTERVAL * 1000UL);  // Iniciar timer de reintento
+    }
+}
+
+// WiFi asociado: abrir UDP, saludar al MASTER y pedir el patrón
+void onMasterConnected(bool audioFeedback) {
+    Serial.println("\n✓ WiFi connected!");
+    Serial.print("  IP Address: ");
+    Serial.println(WiFi.localIP());
+    Serial.printf("  Signal strength: %d dBm\n", WiFi.RSSI());
+    Serial.printf("  MAC Address: %s\n", WiFi.macAddress().c_str());
+    
+    // PASO 3: Inicializar UDP y enviar hello
+    Serial.println("\n[3/3] Initializing UDP communication...");
+    udp.begin(udpPort);
+    udpConnected = true;
+    diagnostic.udpConnected = true;
+    diagnostic.lastError = "";
+    
+    // Enviar hello al master
+    JsonDocument doc;
+    doc["cmd"] = "hello";
+    doc["device"] = "SURFACE";
+    sendUDPCommand(doc);
+    
+    Serial.println("✓ UDP initialized - Ready to send commands");
+    
+    // Sonido de confirmación al conectar: 3 samples rápidos (solo en el modo bloqueante;
+    // en segundo plano un único CLAP para no parar loop())
+    int claps = audioFeedback ? 3 : 1;
+    for (int i = 0; i < claps; i++) {
+        // Enviar comando para reproducir CLAP (sample 4)
+        JsonDocument triggerDoc;
+        triggerDoc["cmd"] = "trigger";
+        triggerDoc["track"] = 4;  // CLAP
+        sendUDPCommand(triggerDoc);
+        if (audioFeedback) delay(100);
+    }
+    Serial.println("♪ Connection confirmed with audio feedback");
+    
+    // Solicitar patrón actual al MASTER automáticamente
+    if (audioFeedback) delay(100);  // Dar tiempo al MASTER para procesar hello
+    requestPatternFromMaster();
+    Serial.println("► Auto-requesting pattern from MASTER...");
+}
+
+// Lanzar la asociación sin escanear ni esperar; pollWiFiConnect() la completa desde loop()
+void startWiFiConnect() {
+    Serial.printf("► WiFi: connecting to '%s' in background...\n", ssid);
+    WiFi.mode(WIFI_STA);
+    WiFi.begin(ssid, password);
+    wifiConnState = WIFI_CONN_PENDING;
+    wifiConnStart = millis();
+}
+
+void pollWiFiConnect() {
+    if (wifiConnState != WIFI_CONN_PENDING) return;
+    
+    if (WiFi.status() == WL_CONNECTED) {
+        wifiConnState = WIFI_CONN_IDLE;
+        Serial.printf("► WiFi: associated after %lu ms\n", millis() - wifiConnStart);
+        onMasterConnected(false);
+        if (currentScreen != SCREEN_BOOT) needsFullRedraw = true;  // Estado ONLINE en pantalla
+    } else if (millis() - wifiConnStart > WIFI_CONNECT_TIMEOUT) {
+        wifiConnState = WIFI_CONN_IDLE;
+        Serial.printf("✗ WiFi connection FAILED (status %d) - retry in %lu s\n",
+                     WiFi.status(), UDP_CHECK_INTERVAL / 1000);
+        udpConnected = false;
+        diagnostic.udpConnected = false;
+        diagnostic.lastError = "Connection timeout";
+        schedAfter(TASK_WIFI_RETRY, UDP_CHECK_INTERVAL * 1000UL);
+    }
+}
+
+// ============================================
+// BOOT TIMING
+// ============================================
+void bootMark(const char* phase) {
+    if (bootPhaseCount >= BOOT_MAX_PHASES) return;
+    bootPhases[bootPhaseCount++] = {phase, (uint32_t)micros()};
+}
+
+// Pausas cosméticas del arranque: solo en el arranque completo
+void bootPause(unsigned long ms) {
+    if (!fastBoot) delay(ms);
+}
+
+void logBootPhases() {
+    Serial.printf("\n► BOOT (%s):\n", fastBoot ? "fast" : "full");
+    uint32_t prev = 0;
+    for (int i = 0; i < bootPhaseCount; i++) {
+        Serial.printf("    %-10s +%6lu us  @ %7lu us\n", bootPhases[i].name,
+                     (unsigned long)(bootPhases[i].us - prev), (unsigned long)bootPhases[i].us);
+        prev = bootPhases[i].us;
     }
 }
 
@@ -735,11 +1744,54 @@ void receiveUDPData() {
                         
                         Serial.printf("► Total active steps: %d\n", totalStepsActive);
                         
+                        // Velocity por step (opcional): un string hex de 16 nibbles por track
+                        resetStepVelocities(patterns[patternNum]);
+                        JsonArray velData = doc["vel"];
+                        if (velData) {
+                            int velTracks = min((int)velData.size(), MAX_TRACKS);
+                            for (int t = 0; t < velTracks; t++) {
+                                decodeVelocityTrack(patterns[patternNum], t, velData[t]);
+                            }
+                            Serial.printf("► Velocity layer received: %d tracks\n", velTracks);
+                        }
+                        
+                        // Condiciones por step (opcional): 32 dígitos hex (1 byte por step) por track
+                        memset(patterns[patternNum].cond, COND_ALWAYS, sizeof(patterns[patternNum].cond));
+                        JsonArray condData = doc["cond"];
+                        if (condData) {
+                            int condTracks = min((int)condData.size(), MAX_TRACKS);
+                            for (int t = 0; t < condTracks; t++) {
+                                const char* hex = condData[t];
+                                for (int s = 0; hex && s < MAX_STEPS && hex[s * 2] && hex[s * 2 + 1]; s++) {
+                                    char byteHex[3] = {hex[s * 2], hex[s * 2 + 1], 0};
+                                    patterns[patternNum].cond[t][s] = (uint8_t)strtoul(byteHex, nullptr, 16);
+                                }
+                            }
+                            Serial.printf("► Step conditions received: %d tracks\n", condTracks);
+                        }
+                        
+                        // Microtiming por step (opcional): 16 enteros en 1/96 de step
+                        memset(patterns[patternNum].micro, 0, sizeof(patterns[patternNum].micro));
+                        JsonArray microData = doc["micro"];
+                        if (microData) {
+                            int microSteps = min((int)microData.size(), MAX_STEPS);
+                            for (int st = 0; st < microSteps; st++) {
+                                int value = microData[st];
+                                patterns[patternNum].micro[st] = constrain(value, -MICRO_MAX, MICRO_MAX);
+                            }
+                        }
+                        
                         // Debug: imprimir patrón recibido
                         printReceivedPattern(patternNum);
                         
+                        // Prefetch del patrón armado completado
+                        if (patternNum == pendingPattern) {
+                            pendingPatternFetched = true;
+                        }
+                        
                         // Forzar redibujado SIEMPRE que se reciba un patrón
                         if (patternNum == currentPattern) {
+                            rebuildStepTimingTable();
                             needsFullRedraw = true;
                             needsGridUpdate = true;
                             updateStepLEDsForTrack(selectedTrack);
@@ -748,6 +1800,7 @@ void receiveUDPData() {
                         
                         // Mostrar notificación en TFT
                         if (currentScreen == SCREEN_SEQUENCER) {
+                            bandWaitIdle();
                             tft.fillRect(0, 290, 320, 30, COLOR_BG);
                             tft.setTextColor(COLOR_SUCCESS, COLOR_BG);
                             tft.setTextSize(1);
@@ -763,11 +1816,55 @@ void receiveUDPData() {
                     }
                 }
                 
+                // Velocity de un track (16 nibbles en hex)
+                else if (strcmp(cmd, "stepVel") == 0) {
+                    int patternNum = doc["pattern"] | currentPattern;
+                    int track = doc["track"] | -1;
+                    if (patternNum >= 0 && patternNum < MAX_PATTERNS && track >= 0 && track < MAX_TRACKS &&
+                        decodeVelocityTrack(patterns[patternNum], track, doc["vel"])) {
+                        if (patternNum == currentPattern && currentScreen == SCREEN_SEQUENCER) {
+                            needsGridUpdate = true;
+                        }
+                    }
+                }
+                
+                // Condición de un step
+                else if (strcmp(cmd, "stepCond") == 0) {
+                    int patternNum = doc["pattern"] | currentPattern;
+                    int track = doc["track"] | -1;
+                    int step = doc["step"] | -1;
+                    if (patternNum >= 0 && patternNum < MAX_PATTERNS && track >= 0 && track < MAX_TRACKS &&
+                        step >= 0 && step < MAX_STEPS) {
+                        patterns[patternNum].cond[track][step] = (uint8_t)(doc["cond"] | 0);
+                        if (patternNum == currentPattern && currentScreen == SCREEN_SEQUENCER) {
+                            needsGridUpdate = true;
+                        }
+                    }
+                }
+                
+                // Swing global del MASTER
+                else if (strcmp(cmd, "swing_sync") == 0) {
+                    int newSwing = doc["value"] | swingAmount;
+                    swingAmount = constrain(newSwing, SWING_MIN, SWING_MAX);
+                    rebuildStepTimingTable();
+                    Serial.printf("✓ Swing synced: %d%%\n", swingAmount);
+                }
+                
+                // Semilla y FILL compartidos con el MASTER
+                else if (strcmp(cmd, "cond_seed") == 0) {
+                    conditionSeed = doc["seed"] | conditionSeed;
+                    Serial.printf("✓ Condition seed synced: 0x%08X\n", conditionSeed);
+                }
+                else if (strcmp(cmd, "fill_state") == 0) {
+                    fillActive = doc["value"] | false;
+                }
+                
                 // Actualización del step actual (para sincronizar visualización)
                 else if (strcmp(cmd, "step_update") == 0) {
                     int newStep = doc["step"] | 0;
                     if (newStep != currentStep) {
                         currentStep = newStep;
+                        lastStepTime = millis() - stepTimingOffset[currentStep];  // Fase de rejilla para cuantizar
                         // Actualizar visualización si estamos en pantalla sequencer
                         if (currentScreen == SCREEN_SEQUENCER) {
                             needsGridUpdate = true;
@@ -813,6 +1910,7 @@ void receiveUDPData() {
                     int newStep = doc["step"];
                     if (newStep >= 0 && newStep < MAX_STEPS) {
                         currentStep = newStep;
+                        lastStepTime = millis() - stepTimingOffset[currentStep];
                         if (currentScreen == SCREEN_SEQUENCER) {
                             needsGridUpdate = true;
                         }
@@ -845,9 +1943,14 @@ void receiveUDPData() {
 
 // Solicitar patrón al MASTER
 void requestPatternFromMaster() {
+    requestPatternFromMaster(currentPattern);
+}
+
+void requestPatternFromMaster(int patternNum) {
     if (!udpConnected) {
         Serial.println("✗ Cannot request pattern: UDP not connected");
         if (currentScreen == SCREEN_SEQUENCER) {
+            bandWaitIdle();
             tft.fillRect(0, 290, 320, 30, COLOR_BG);
             tft.setTextColor(COLOR_ERROR, COLOR_BG);
             tft.setTextSize(1);
@@ -859,27 +1962,41 @@ void requestPatternFromMaster() {
     
     JsonDocument doc;
     doc["cmd"] = "get_pattern";
-    doc["pattern"] = currentPattern;
+    doc["pattern"] = patternNum;
     sendUDPCommand(doc);
     
     Serial.println("\n───────────────────────────────────────");
-    Serial.printf("► REQUESTING Pattern %d from MASTER\n", currentPattern + 1);
+    Serial.printf("► REQUESTING Pattern %d from MASTER\n", patternNum + 1);
     Serial.printf("   Master IP: %s:%d\n", masterIP, udpPort);
     Serial.println("   Waiting for response...");
     Serial.println("───────────────────────────────────────\n");
     
     // Mostrar en pantalla que se está sincronizando
     if (currentScreen == SCREEN_SEQUENCER) {
+        bandWaitIdle();
         tft.fillRect(0, 290, 320, 30, COLOR_BG);
         tft.setTextColor(COLOR_WARNING, COLOR_BG);
         tft.setTextSize(1);
         tft.setCursor(10, 295);
-        tft.printf("Requesting Pattern %d...", currentPattern + 1);
+        tft.printf("Requesting Pattern %d...", patternNum + 1);
     }
 }
 
 void calculateStepInterval() {
     stepInterval = (60000 / tempo) / 4;
+    rebuildStepTimingTable();
+}
+
+// Precalcular el desplazamiento de cada step sobre la rejilla (swing + microtiming).
+// Se rehace al cambiar tempo, swing o patrón: el reloj solo consulta la tabla.
+void rebuildStepTimingTable() {
+    const Pattern& pattern = patterns[currentPattern];
+    long swingOffset = (long)stepInterval * (swingAmount - SWING_MIN) / 50;
+    for (int s = 0; s < MAX_STEPS; s++) {
+        long offset = (s & 1) ? swingOffset : 0;
+        offset += (long)stepInterval * pattern.micro[s] / MICRO_TICKS;
+        stepTimingOffset[s] = offset;
+    }
 }
 
 // ============================================
@@ -1415,14 +2532,27 @@ void testButtonsOnBoot() {
 // SETUP
 // ============================================
 void setup() {
+    bootMark("reset");
     Serial.begin(115200);
-    delay(1000);
+    
+    // BACK pulsado al encender = arranque completo (ADC con la configuración por defecto)
+    int bootAdc = analogRead(ANALOG_BUTTONS_PIN);
+    if (bootAdc >= BTN_BACK_MIN && bootAdc <= BTN_BACK_MAX) {
+        fastBoot = false;
+    }
+    bootPause(1000);
     
     Serial.println("\n\n╔════════════════════════════════════╗");
     Serial.println("║   RED808 V6 - SURFACE (SLAVE)     ║");
     Serial.println("║   UDP Controller via WiFi          ║");
     Serial.println("║   Connects to MASTER DrumMachine   ║");
     Serial.println("╚════════════════════════════════════╝\n");
+    
+    // La radio asocia en paralelo mientras se inicializa el resto del hardware
+    if (fastBoot) {
+        startWiFiConnect();
+    }
+    bootMark("serial");
 
     // TFT Init
     Serial.print("► TFT Init... ");
@@ -1433,26 +2563,33 @@ void setup() {
     tft.fillScreen(COLOR_BG);
     diagnostic.tftOk = true;
     Serial.println("OK (480x320)");
+    setupBandRenderer();
+    setupStripRenderer();
+    setupTileCache();
+    if (!fastBoot) {
+        benchmarkCellTiles();
+    }
+    bootMark("tft");
+    
+    // TM1638 #1 y #2: mismo bus, se inicializan juntos
+    tmBusBegin();
+    tmBrightness(7);
+    tmClear();
+    tmShadowReset(0);
+    tmShadowReset(1);
     
-    // TM1638 #1
     Serial.print("► TM1638 #1 Init... ");
-    tm1.displayBegin();
-    tm1.brightness(7);
-    tm1.reset();
-    tm1.displayText("STEP1-8 ");
+    tmDisplayText(0, "STEP1-8 ");
     diagnostic.tm1638_1_Ok = true;
     Serial.println("OK");
-    delay(200);
+    bootPause(200);
     
-    // TM1638 #2
     Serial.print("► TM1638 #2 Init... ");
-    tm2.displayBegin();
-    tm2.brightness(7);
-    tm2.reset();
-    tm2.displayText("STE9-16 ");
+    tmDisplayText(1, "STE9-16 ");
     diagnostic.tm1638_2_Ok = true;
     Serial.println("OK");
-    delay(200);
+    bootPause(200);
+    bootMark("tm1638");
     
     // Encoder
     Serial.print("► Rotary Encoder Init... ");
@@ -1468,30 +2605,10 @@ void setup() {
     pinMode(VOLUME_TOGGLE_BTN, INPUT_PULLUP);
     Serial.println("► Volume Toggle Button ready on pin 14 (SEQ/PADS)");
     
-    // Configurar interrupciones para CLK y DT
-    attachInterrupt(digitalPinToInterrupt(ENCODER_CLK), []() {
-        uint8_t clk = digitalRead(ENCODER_CLK);
-        uint8_t dt = digitalRead(ENCODER_DT);
-        encoderState = (encoderState << 2) | (clk << 1) | dt;
-        encoderState &= 0x0F;
-        int8_t change = encoderStates[encoderState];
-        if (change != 0) {
-            encoderPos += change;
-            encoderChanged = true;
-        }
-    }, CHANGE);
-    
-    attachInterrupt(digitalPinToInterrupt(ENCODER_DT), []() {
-        uint8_t clk = digitalRead(ENCODER_CLK);
-        uint8_t dt = digitalRead(ENCODER_DT);
-        encoderState = (encoderState << 2) | (clk << 1) | dt;
-        encoderState &= 0x0F;
-        int8_t change = encoderStates[encoderState];
-        if (change != 0) {
-            encoderPos += change;
-            encoderChanged = true;
-        }
-    }, CHANGE);
+    // Configurar interrupciones para CLK y DT (la misma ISR para los dos)
+    encoderState = (digitalRead(ENCODER_CLK) << 1) | digitalRead(ENCODER_DT);
+    attachInterrupt(digitalPinToInterrupt(ENCODER_CLK), encoderISR, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(ENCODER_DT), encoderISR, CHANGE);
     
     diagnostic.encoderOk = true;
     Serial.println("OK");
@@ -1500,63 +2617,83 @@ void setup() {
     Serial.print("► ADC Init... ");
     analogReadResolution(12);
     analogSetAttenuation(ADC_11db);
-    Serial.println("OK");
-    
-    // Boot estilo consola UNIX
-    drawConsoleBootScreen();
-    
-    // Conectar al MASTER vía WiFi UDP
-    setupWiFiAndUDP();
+    setupAdcSampler();
+    Serial.println(adcDmaRunning ? "OK (DMA)" : "OK");
+    bootMark("inputs");
     
-    // Mostrar estado de conexión en pantalla
-    tft.fillRect(0, 270, 480, 50, 0x0000);
-    tft.setTextSize(2);
-    if (udpConnected) {
-        tft.setTextColor(THEME_RED808.success);
-        tft.setCursor(100, 280);
-        tft.println("CONNECTED TO MASTER");
-        tft.setTextSize(1);
-        tft.setTextColor(THEME_RED808.accent2);
-        tft.setCursor(150, 300);
-        tft.printf("IP: %s", WiFi.localIP().toString().c_str());
-    } else {
-        tft.setTextColor(THEME_RED808.error);
-        tft.setCursor(120, 280);
-        tft.println("NO MASTER CONNECTION");
-        tft.setTextSize(1);
-        tft.setTextColor(THEME_RED808.warning);
-        tft.setCursor(140, 300);
-        tft.println("Will retry in background...");
+    if (!fastBoot) {
+        // Boot estilo consola UNIX
+        drawConsoleBootScreen();
+        
+        // Conectar al MASTER vía WiFi UDP
+        setupWiFiAndUDP();
+        bootMark("wifi");
+        
+        // Mostrar estado de conexión en pantalla
+        tft.fillRect(0, 270, 480, 50, 0x0000);
+        tft.setTextSize(2);
+        if (udpConnected) {
+            tft.setTextColor(THEME_RED808.success);
+            tft.setCursor(100, 280);
+            tft.println("CONNECTED TO MASTER");
+            tft.setTextSize(1);
+            tft.setTextColor(THEME_RED808.accent2);
+            tft.setCursor(150, 300);
+            tft.printf("IP: %s", WiFi.localIP().toString().c_str());
+        } else {
+            tft.setTextColor(THEME_RED808.error);
+            tft.setCursor(120, 280);
+            tft.println("NO MASTER CONNECTION");
+            tft.setTextSize(1);
+            tft.setTextColor(THEME_RED808.warning);
+            tft.setCursor(140, 300);
+            tft.println("Will retry in background...");
+        }
+        delay(1500);
     }
-    delay(1500);
     
     setupKits();
     setupPatterns();
     calculateStepInterval();
-    
-    // LED test rápido
-    for (int i = 0; i < 16; i++) {
-        setLED(i, true);
-        delay(30);
-    }
-    delay(100);
-    setAllLEDs(0x0000);
-    
-    // Spectrum Analyzer Animation
-    drawSpectrumAnimation();
-    
-    if (udpConnected) {
-        tm1.displayText("SURFACE ");
-        tm2.displayText("READY   ");
+    bootMark("state");
+    
+    if (fastBoot) {
+        // LED test sin bloquear: todos encendidos y updateLEDFeedback() los apaga en barrido
+        unsigned long now = millis();
+        for (int i = 0; i < 16; i++) {
+            setLED(i, true);
+            armLedOff(i, now + 100 + i * 30);
+        }
     } else {
-        tm1.displayText("NO CONN ");
-        tm2.displayText("MASTER  ");
+        // LED test rápido
+        for (int i = 0; i < 16; i++) {
+            setLED(i, true);
+            delay(30);
+        }
+        delay(100);
+        setAllLEDs(0x0000);
+        
+        // Spectrum Analyzer Animation
+        drawSpectrumAnimation();
     }
     
-    delay(500);
+    if (udpConnected) {
+        tmDisplayText(0, "SURFACE ");
+        tmDisplayText(1, "READY   ");
+    } else if (wifiConnState == WIFI_CONN_PENDING) {
+        tmDisplayText(0, "SURFACE ");
+        tmDisplayText(1, "CONNECT ");
+    } else {
+        tmDisplayText(0, "NO CONN ");
+        tmDisplayText(1, "MASTER  ");
+    }
+    
+    bootPause(500);
     
     currentScreen = SCREEN_MENU;
     needsFullRedraw = true;
+    schedStart();
+    bootMark("setup");
     
     Serial.println("\n╔════════════════════════════════════╗");
     Serial.println("║   RED808 SURFACE READY!            ║");
@@ -1568,41 +2705,200 @@ void setup() {
 // MAIN LOOP
 // ============================================
 void loop() {
-    static unsigned long lastLoopTime = 0;
-    unsigned long currentTime = millis();
-    
-    if (currentTime - lastLoopTime < 16) {
-        return;
+    // Un detent del encoder adelanta la lectura de entradas
+    if (__atomic_load_n(&encoderHead, __ATOMIC_ACQUIRE) != encoderTail) {
+        schedBy(TASK_INPUT, micros());
     }
-    lastLoopTime = currentTime;
-    
+    runDueTasks();
+    schedSleep();
+}
+
+// ============================================
+// PLANIFICADOR
+// ============================================
+struct TaskDef {
+    void (*run)();
+    uint32_t periodUs;         // 0 = plazo único (lo arma quien lo necesita)
+};
+// Mismo orden que enum TaskId: es la prioridad dentro de una vuelta
+const TaskDef TASKS[] = {
+    {samplePadInputs,          PAD_SAMPLE_INTERVAL_US},
+    {serviceNoteRepeat,        0},
+    {pollAdcInputs,            ADC_BLOCK_INTERVAL_US},
+    {inputTask,                INPUT_INTERVAL_MS * 1000UL},
+    {debugAnalogButtons,       ADC_DEBUG_INTERVAL_MS * 1000UL},
+    {handleVolume,             VOLUME_INTERVAL_MS * 1000UL},
+    {sequencerTask,            SEQUENCER_INTERVAL_MS * 1000UL},
+    {networkTask,              NETWORK_INTERVAL_MS * 1000UL},
+    {wifiRetryTask,            UDP_CHECK_INTERVAL * 1000UL},
+    {updateAudioVisualization, VIZ_INTERVAL_MS * 1000UL},
+    {revertInstrumentDisplay,  0},
+    {cycleLiveDisplay,         DISPLAY_CYCLE_MS * 1000UL},
+    {frameTask,                FRAME_INTERVAL_MS * 1000UL},
+    {updateLEDFeedback,        0},
+    {reportStats,              TM_BUS_REPORT_MS * 1000UL},
+};
+static_assert(sizeof(TASKS) / sizeof(TASKS[0]) == TASK_COUNT, "TASKS y TaskId deben coincidir");
+
+void schedAt(int task, uint32_t dueUs) {
+    taskState[task].armed = true;
+    taskState[task].dueUs = dueUs;
+}
+
+void schedAfter(int task, uint32_t delayUs) {
+    schedAt(task, micros() + delayUs);
+}
+
+// Armar o adelantar (nunca retrasa un plazo ya armado)
+void schedBy(int task, uint32_t dueUs) {
+    TaskState& state = taskState[task];
+    if (!state.armed || (int32_t)(dueUs - state.dueUs) < 0) {
+        schedAt(task, dueUs);
+    }
+}
+
+void schedCancel(int task) {
+    taskState[task].armed = false;
+}
+
+// Despertar el loop si está dormido en schedSleep()
+void IRAM_ATTR schedWakeFromISR() {
+#ifdef ESP_PLATFORM
+    if (!loopTaskHandle) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(loopTaskHandle, &woken);
+    if (woken) portYIELD_FROM_ISR();
+#endif
+}
+
+// Arrancar las tareas periódicas (los plazos únicos ya armados se conservan)
+void schedStart() {
+#ifdef ESP_PLATFORM
+    loopTaskHandle = xTaskGetCurrentTaskHandle();
+#endif
+    uint32_t now = micros();
+    for (int i = 0; i < TASK_COUNT; i++) {
+        if (TASKS[i].periodUs && !taskState[i].armed) {
+            schedAt(i, now + TASKS[i].periodUs);
+        }
+    }
+    if (currentScreen != SCREEN_LIVE) {
+        schedCancel(TASK_PADS);
+    }
+    schedStats.windowStart = millis();
+}
+
+// Ejecutar las tareas vencidas en un solo frame de los TM1638. Una periódica se re-arma
+// antes de correr (la tarea puede adelantar o cancelar su próximo plazo); si va retrasada
+// más de un periodo, no recupera las vueltas perdidas.
+void runDueTasks() {
+    bool woke = false;
+    for (int i = 0; i < TASK_COUNT; i++) {
+        TaskState& state = taskState[i];
+        uint32_t now = micros();
+        if (!state.armed || (int32_t)(now - state.dueUs) < 0) continue;
+        
+        if (TASKS[i].periodUs) {
+            state.dueUs += TASKS[i].periodUs;
+            if ((int32_t)(now - state.dueUs) >= 0) {
+                state.dueUs = now + TASKS[i].periodUs;
+            }
+        } else {
+            state.armed = false;
+        }
+        if (!woke) {
+            tmBeginFrame();
+            woke = true;
+        }
+        TASKS[i].run();
+        state.runs++;
+        schedStats.runs++;
+    }
+    if (woke) {
+        tmEndFrame();
+        schedStats.wakes++;
+    }
+}
+
+// Dormir hasta el próximo plazo: desde un tick se cede la CPU a FreeRTOS (la ISR del
+// encoder despierta antes); por debajo, espera activa hasta el plazo exacto
+void schedSleep() {
+    uint32_t now = micros();
+    int32_t waitUs = SCHED_MAX_SLEEP_MS * 1000L;
+    for (int i = 0; i < TASK_COUNT; i++) {
+        if (!taskState[i].armed) continue;
+        int32_t left = (int32_t)(taskState[i].dueUs - now);
+        if (left < waitUs) waitUs = left;
+    }
+    if (waitUs <= 0) return;
+    
+    if (waitUs >= SCHED_MIN_SLEEP_US) {
+#ifdef ESP_PLATFORM
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitUs / 1000));
+#else
+        delay(waitUs / 1000);
+#endif
+    } else {
+        delayMicroseconds(waitUs);
+    }
+    schedStats.idleUs += micros() - now;
+}
+
+// Entradas: muestreo de todos los controles y sus handlers
+void inputTask() {
+    sampleInputs(millis());
     handleButtons();
     handleEncoder();
-    
-    // DEBUG: Mostrar valores ADC de botones analógicos
-    debugAnalogButtons();
-    
     handlePlayStopButton();
     handleMuteButton();
     handleBackButton();
-    
-    if (currentTime - lastVolumeRead > 100) {
-        handleVolume();
-        lastVolumeRead = currentTime;
-    }
-    
+}
+
+void sequencerTask() {
     if (isPlaying) {
         updateSequencer();
+        // Despertar justo en el próximo step (rejilla + swing + microtiming)
+        int nextStep = (currentStep + 1) % MAX_STEPS;
+        unsigned long due = lastStepTime + stepInterval + stepTimingOffset[nextStep];
+        schedBy(TASK_SEQUENCER, (uint32_t)(due * 1000UL));
+        return;
+    }
+    
+    // Parado: el próximo play empieza en el loop 0
+    clockPrevStep = -1;
+    loopCount = 0;
+    
+    if (recordBatchPattern >= 0) {
+        flushRecordBatch();
     }
     
+    // Sin reloj de steps no hay fin de compás: aplicar ya
+    if (pendingPattern >= 0) {
+        applyPatternChange(pendingPattern);
+    }
+}
+
+void networkTask() {
     // Recibir datos UDP del MASTER
     receiveUDPData();
     
-    // Reconectar WiFi si se pierde la conexión
-    if (!udpConnected && (currentTime - lastUdpCheck > UDP_CHECK_INTERVAL)) {
-        lastUdpCheck = currentTime;
-        Serial.println("\n═══ AUTO-RETRY WiFi CONNECTION ═══");
-        
+    // Asociación en segundo plano (arranque rápido y reintentos)
+    pollWiFiConnect();
+    
+    // step_update del MASTER: procesar el step sin esperar al periodo del secuenciador
+    if (isPlaying && currentStep != clockPrevStep) {
+        schedBy(TASK_SEQUENCER, micros());
+    }
+}
+
+// Reconectar WiFi si se pierde la conexión (cada UDP_CHECK_INTERVAL)
+void wifiRetryTask() {
+    if (udpConnected || wifiConnState != WIFI_CONN_IDLE) return;
+    Serial.println("\n═══ AUTO-RETRY WiFi CONNECTION ═══");
+    
+    if (fastBoot) {
+        startWiFiConnect();
+    } else {
         // Mostrar pantalla de sincronización
         drawSyncingScreen();
         
@@ -1612,51 +2908,38 @@ void loop() {
         // Restaurar pantalla anterior
         needsFullRedraw = true;
     }
-    
-    updateAudioVisualization();
-    
-    if (needsFullRedraw) {
-        switch (currentScreen) {
-            case SCREEN_MENU:
-                drawMainMenu();
-                break;
-            case SCREEN_LIVE:
-                drawLiveScreen();
-                break;
-            case SCREEN_SEQUENCER:
-                drawSequencerScreen();
-                break;
-            case SCREEN_SETTINGS:
-                drawSettingsScreen();
-                break;
-            case SCREEN_DIAGNOSTICS:
-                drawDiagnosticsScreen();
-                break;
-            case SCREEN_PATTERNS:
-                drawPatternsScreen();
-                break;
-            default:
-                break;
-        }
-        
-        needsFullRedraw = false;
-        needsHeaderUpdate = false;
-        needsGridUpdate = false;
-        
-    } else {
-        if (needsHeaderUpdate && currentScreen != SCREEN_MENU) {
-            drawHeader();
-            needsHeaderUpdate = false;
-        }
-        
-        if (needsGridUpdate && currentScreen == SCREEN_SEQUENCER) {
-            drawSequencerScreen();
-            needsGridUpdate = false;
-        }
+}
+
+void frameTask() {
+    // Render con presupuesto: lo que no quepa sigue en el próximo frame
+    scheduleRender();
+    runRenderJob();
+    
+    // Tiempo hasta el primer menú interactivo
+    if (bootReportPending && currentScreen == SCREEN_MENU && !renderJob.active) {
+        bootReportPending = false;
+        bootMark("menu");
+        logBootPhases();
     }
     
     updateTM1638Displays();
-    updateLEDFeedback();
+}
+
+void reportStats() {
+    reportTMBusStats();
+    reportSchedStats();
+}
+
+// Vueltas del loop con trabajo, tareas ejecutadas y tiempo dormido por segundo
+void reportSchedStats() {
+    unsigned long now = millis();
+    unsigned long elapsed = now - schedStats.windowStart;
+    if (!elapsed) return;
+    Serial.printf("► Loop: %lu wakes/s, %lu tasks/s, idle %lu%%\n",
+                 (unsigned long)(schedStats.wakes * 1000UL / elapsed),
+                 (unsigned long)(schedStats.runs * 1000UL / elapsed),
+                 (unsigned long)(schedStats.idleUs / 10 / elapsed));
+    schedStats = {0, 0, 0, now};
 }
 
 // ============================================
@@ -1668,13 +2951,16 @@ void updateSequencer() {
     
     if (isPlaying) {
         unsigned long currentTime = millis();
+        int nextStep = (currentStep + 1) % MAX_STEPS;
         
-        // Calcular intervalo entre steps basado en tempo actual
-        unsigned long stepInterval = (60000 / tempo) / 4;  // 4 steps por beat (16th notes)
-        
-        if (currentTime - lastStepTime >= stepInterval) {
-            lastStepTime = currentTime;
-            currentStep = (currentStep + 1) % MAX_STEPS;
+        // Próximo step = rejilla + offset precalculado (swing + microtiming)
+        if ((long)(currentTime - lastStepTime) >= (long)stepInterval + stepTimingOffset[nextStep]) {
+            lastStepTime += stepInterval;
+            // Si el loop se retrasó más de un step, re-anclar la rejilla en vez de recuperar
+            if ((long)(currentTime - lastStepTime) > (long)stepInterval) {
+                lastStepTime = currentTime - stepTimingOffset[nextStep];
+            }
+            currentStep = nextStep;
             
             // Forzar actualización de visualización en sequencer
             if (currentScreen == SCREEN_SEQUENCER) {
@@ -1683,46 +2969,173 @@ void updateSequencer() {
         }
     }
     
+    // Procesar cada step nuevo una sola vez (avance local o step_update del MASTER)
+    if (currentStep != clockPrevStep) {
+        // Fin de compás: el step vuelve al principio
+        if (currentStep < clockPrevStep && clockPrevStep - currentStep > MAX_STEPS / 2) {
+            handleBarBoundary();
+        }
+        clockPrevStep = currentStep;
+        evaluateStepConditions(currentStep);
+    }
+    
     // Actualizar LEDs basándose en currentStep
     updateStepLEDs();
 }
 
+void handleBarBoundary() {
+    loopCount++;
+    
+    // Enviar lo grabado en el compás que termina (antes de un posible cambio de patrón)
+    if (recordBatchPattern >= 0) {
+        flushRecordBatch();
+    }
+    
+    if (pendingPattern < 0) return;
+    
+    barsUntilSwitch--;
+    if (barsUntilSwitch <= 0) {
+        Serial.printf("► Bar boundary: switching to pattern %d\n", pendingPattern + 1);
+        applyPatternChange(pendingPattern);
+    }
+}
+
 // ============================================
 // DRUM TRIGGER (UDP)
 // ============================================
 
-void triggerDrum(int track) {
-    // Enviar comando UDP al MASTER para reproducir el instrumento
-    // La velocity está basada en el volumen de Live Pads (con boost del 25%)
+// La velocity está basada en el volumen de Live Pads (con boost del 25%)
+int liveVelocity() {
     int boostedVolume = min((int)(livePadsVolume * 1.25), MAX_VOLUME);
     int velocity = map(boostedVolume, 0, MAX_VOLUME, 0, 127);
-    velocity = constrain(velocity, 0, 127);
-    
+    return constrain(velocity, 0, 127);
+}
+
+void triggerDrum(int track) {
+    sendTrigger(track, liveVelocity());
+    showInstrumentOnTM1638(track);
+}
+
+// Enviar comando UDP al MASTER para reproducir el instrumento
+void sendTrigger(int track, int velocity) {
     JsonDocument doc;
     doc["cmd"] = "trigger";
     doc["pad"] = track;
     doc["vel"] = velocity;
     sendUDPCommand(doc);
     
-    // Actualizar visualización local
-    audioLevels[track] = 100;
-    showInstrumentOnTM1638(track);
+    // Actualizar visualización local (solo hay 8 barras)
+    if (track < 8) audioLevels[track] = 100;
+}
+
+// ============================================
+// NOTE REPEAT
+// ============================================
+
+uint32_t noteRepeatPeriodUs() {
+    const RepeatRateInfo& rate = REPEAT_RATES[repeatRate];
+    return 15000000UL * rate.num / ((uint32_t)tempo * rate.den);
+}
+
+// Primer punto de la rejilla (anchorUs + k * periodo) posterior a afterUs
+uint32_t noteRepeatNext(uint32_t anchorUs, uint32_t afterUs, uint32_t periodUs) {
+    int32_t elapsed = (int32_t)(afterUs - anchorUs);
+    int32_t k = elapsed >= 0 ? elapsed / (int32_t)periodUs + 1 : -(-elapsed / (int32_t)periodUs);
+    return anchorUs + (uint32_t)(k * (int32_t)periodUs);
+}
+
+// En play la rejilla es la del reloj de steps; parado, la de la pulsación
+uint32_t noteRepeatAnchor(int pad) {
+    return isPlaying ? (uint32_t)(lastStepTime * 1000UL) : noteRepeat[pad].anchorUs;
+}
+
+int noteRepeatVelocity(int count) {
+    int full = liveVelocity();
+    int low = full / 4;
+    switch (repeatRamp) {
+        case RAMP_UP:   return min(full, low + count * NOTE_REPEAT_RAMP_STEP);
+        case RAMP_DOWN: return max(low, full - (count + 1) * NOTE_REPEAT_RAMP_STEP);
+        default:        return full;
+    }
+}
+
+// La primera repetición cae en la rejilla al menos medio periodo después del golpe
+void armNoteRepeat(int pad, unsigned long pressTime) {
+    NoteRepeat& repeat = noteRepeat[pad];
+    uint32_t periodUs = noteRepeatPeriodUs();
+    repeat.active = true;
+    repeat.count = 0;
+    repeat.anchorUs = (uint32_t)(pressTime * 1000UL);
+    repeat.nextUs = noteRepeatNext(noteRepeatAnchor(pad), repeat.anchorUs + periodUs / 2, periodUs);
+    schedBy(TASK_NOTE_REPEAT, repeat.nextUs);
+}
+
+void serviceNoteRepeat() {
+    uint32_t now = micros();
+    for (int i = 0; i < 16; i++) {
+        NoteRepeat& repeat = noteRepeat[i];
+        if (!repeat.active) continue;
+        if (!(sampledButtons & (1 << i))) {
+            repeat.active = false;
+            continue;
+        }
+        if ((int32_t)(now - repeat.nextUs) < 0) {
+            schedBy(TASK_NOTE_REPEAT, repeat.nextUs);
+            continue;
+        }
+        
+        sendTrigger(i, noteRepeatVelocity(repeat.count));
+        if (repeat.count < 255) repeat.count++;
+        if (recordMode && isPlaying) {
+            recordPadHit(i, repeat.nextUs / 1000);
+        }
+        // Siguiente punto de la rejilla (sigue al tempo; si el loop se retrasó, no recupera)
+        repeat.nextUs = noteRepeatNext(noteRepeatAnchor(i), now, noteRepeatPeriodUs());
+        schedBy(TASK_NOTE_REPEAT, repeat.nextUs);
+    }
+}
+
+void changeRepeatRate(int delta) {
+    repeatRate = (repeatRate + delta % REPEAT_RATE_COUNT + REPEAT_RATE_COUNT) % REPEAT_RATE_COUNT;
+    char display[9];
+    snprintf(display, sizeof(display), "RPT %s", REPEAT_RATES[repeatRate].name);
+    tmDisplayText(0, display);
+    tmDisplayText(1, "        ");
+    deferDisplayCycle();
+    Serial.printf("► Note repeat: %s\n", REPEAT_RATES[repeatRate].name);
+}
+
+void cycleRepeatRamp() {
+    static const char* const RAMP_NAMES[RAMP_COUNT] = {"RAMP OFF", "RAMP UP ", "RAMP DN "};
+    repeatRamp = (repeatRamp + 1) % RAMP_COUNT;
+    tmDisplayText(0, RAMP_NAMES[repeatRamp]);
+    tmDisplayText(1, "        ");
+    deferDisplayCycle();
+    Serial.printf("► Note repeat ramp: %s\n", RAMP_NAMES[repeatRamp]);
 }
 
 void updateStepLEDs() {
     if (isPlaying) {
-        // Durante reproducción: solo mostrar step actual
-        setAllLEDs(0x0000);
-        setLED(currentStep, true);
+        // Durante reproducción: solo mostrar step actual (la sombra solo envía los que cambian)
+        setAllLEDs(1 << currentStep);
         
-        Pattern& pattern = patterns[currentPattern];
-        for (int track = 0; track < MAX_TRACKS; track++) {
-            if (pattern.steps[track][currentStep] && !pattern.muted[track]) {
-                ledActive[currentStep] = true;
-                ledOffTime[currentStep] = millis() + 100;
-            }
+        if (stepTrigMask) {
+            armLedOff(currentStep, millis() + 100);
+        }
+    }
+}
+
+// Resolver qué tracks suenan en este step (steps activos, sin mute y con condición cumplida)
+void evaluateStepConditions(int step) {
+    Pattern& pattern = patterns[currentPattern];
+    uint16_t mask = 0;
+    for (int track = 0; track < MAX_TRACKS; track++) {
+        if (pattern.steps[track][step] && !pattern.muted[track] &&
+            evaluateCondition(pattern.cond[track][step], track, step)) {
+            mask |= (1 << track);
         }
     }
+    stepTrigMask = mask;
 }
 
 // Nueva función: Actualizar LEDs para mostrar steps del track seleccionado
@@ -1743,12 +3156,229 @@ void updateStepLEDsForTrack(int track) {
 // ============================================
 // INPUT HANDLING
 // ============================================
+// Mediana de la ventana + IIR sobre el valor medio del bloque
+static void adcFilterBlock(AdcChannel& ch, int sample) {
+    ch.window[ch.pos] = sample;
+    ch.pos = (ch.pos + 1) % ADC_MEDIAN_TAPS;
+    if (ch.filled < ADC_MEDIAN_TAPS) ch.filled++;
+    uint16_t sorted[ADC_MEDIAN_TAPS];
+    memcpy(sorted, ch.window, ch.filled * sizeof(uint16_t));
+    std::sort(sorted, sorted + ch.filled);
+    int median = sorted[ch.filled / 2];
+    if (ch.filled == 1) {
+        ch.iir = median << 4;
+    } else {
+        ch.iir += ((median << 4) - ch.iir) >> ADC_IIR_SHIFT;
+    }
+    ch.value = (ch.iir + 8) >> 4;
+}
+
+// ADC1 en continuo por DMA; si el driver no arranca se sigue con analogRead. Una lectura
+// inicial por canal llena los filtros antes del primer bloque.
+void setupAdcSampler() {
+    for (AdcChannel& ch : adcInputs) {
+        adcFilterBlock(ch, analogRead(ch.pin));
+    }
+#if ADC_DMA
+    adc_digi_init_config_t initConfig = {};
+    initConfig.max_store_buf_size = 1024;
+    initConfig.conv_num_each_intr = ADC_DMA_FRAME_BYTES;
+    initConfig.adc1_chan_mask = 0;
+    for (const AdcChannel& ch : adcInputs) {
+        initConfig.adc1_chan_mask |= 1 << ch.channel;
+    }
+    adc_digi_pattern_config_t pattern[ADC_IN_COUNT] = {};
+    for (int i = 0; i < ADC_IN_COUNT; i++) {
+        pattern[i].atten = ADC_ATTEN_DB_11;
+        pattern[i].channel = adcInputs[i].channel;
+        pattern[i].unit = 0;  // ADC1
+        pattern[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    }
+    adc_digi_configuration_t config = {};
+    config.conv_limit_en = true;
+    config.conv_limit_num = 250;
+    config.pattern_num = ADC_IN_COUNT;
+    config.adc_pattern = pattern;
+    config.sample_freq_hz = ADC_DMA_SAMPLE_HZ;
+    config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+    if (adc_digi_initialize(&initConfig) == ESP_OK &&
+        adc_digi_controller_configure(&config) == ESP_OK &&
+        adc_digi_start() == ESP_OK) {
+        adcDmaRunning = true;
+    } else {
+        adc_digi_deinitialize();
+        Serial.println("⚠ ADC DMA no disponible: muestreo con analogRead");
+    }
+#endif
+}
+
+// Nivel de la escalera; fuera de las ventanas (transición entre niveles) no decide
+static int ladderLevel(int adc) {
+    if (adc < BTN_NONE_THRESHOLD) return 0;
+    if (adc >= BTN_PLAY_STOP_MIN && adc <= BTN_PLAY_STOP_MAX) return INPUT_PLAY_STOP;
+    if (adc >= BTN_MUTE_MIN && adc <= BTN_MUTE_MAX) return INPUT_MUTE;
+    if (adc >= BTN_BACK_MIN && adc <= BTN_BACK_MAX) return INPUT_BACK;
+    return -1;
+}
+
+static unsigned long ladderHoldMs(uint8_t button) {
+    if (button == INPUT_PLAY_STOP) return PLAY_STOP_HOLD_MS;
+    if (button == INPUT_MUTE) return MUTE_HOLD_MS;
+    return 0;  // BACK: sin hold
+}
+
+static void updateLadder(int adc, unsigned long now) {
+    int level = ladderLevel(adc);
+    if (level >= 0 && level != ladder.candidate) {
+        ladder.candidate = level;
+        ladder.candidateSince = now;
+    }
+    if (ladder.candidate != ladder.stable && now - ladder.candidateSince >= LADDER_DEBOUNCE_MS) {
+        if (ladder.stable) {
+            ladder.released |= ladder.stable;
+            if (!ladder.holdSent && ladder.candidate == 0) ladder.clicked |= ladder.stable;
+        }
+        ladder.stable = ladder.candidate;
+        if (ladder.stable) {
+            ladder.pressed |= ladder.stable;
+            ladder.pressTime = now;
+            ladder.holdSent = false;
+        }
+    }
+    unsigned long holdMs = ladderHoldMs(ladder.stable);
+    if (ladder.stable && holdMs && !ladder.holdSent && now - ladder.pressTime >= holdMs) {
+        ladder.holdSent = true;
+        ladder.held |= ladder.stable;
+    }
+}
+
+// Cerrar un bloque cada ADC_BLOCK_INTERVAL_US: con DMA se vacía lo que haya sin esperar
+// y se promedian todas las muestras de cada canal
+void pollAdcInputs() {
+#if ADC_DMA
+    if (adcDmaRunning) {
+        uint8_t frame[ADC_DMA_FRAME_BYTES];
+        uint32_t length = 0;
+        esp_err_t err;
+        do {
+            err = adc_digi_read_bytes(frame, sizeof(frame), &length, 0);
+            for (uint32_t i = 0; err != ESP_ERR_TIMEOUT && i + 1 < length; i += 2) {
+                const adc_digi_output_data_t* data = (const adc_digi_output_data_t*)&frame[i];
+                for (AdcChannel& ch : adcInputs) {
+                    if (data->type1.channel == ch.channel) {
+                        ch.sum += data->type1.data;
+                        ch.samples++;
+                    }
+                }
+            }
+        } while (err != ESP_ERR_TIMEOUT && length == sizeof(frame));
+    }
+#endif
+    for (AdcChannel& ch : adcInputs) {
+        if (!adcDmaRunning) {
+            for (int i = 0; i < ADC_POLL_OVERSAMPLE; i++) {
+                ch.sum += analogRead(ch.pin);
+            }
+            ch.samples += ADC_POLL_OVERSAMPLE;
+        }
+        if (!ch.samples) continue;
+        adcFilterBlock(ch, ch.sum / ch.samples);
+        ch.sum = 0;
+        ch.samples = 0;
+    }
+    updateLadder(adcInputs[ADC_IN_BUTTONS].value, millis());
+}
+
+// Cada transición válida suma ±1; al completar un detent se publica en el anillo. Si el
+// anillo está lleno el detent se descarta y se cuenta.
+void IRAM_ATTR encoderISR() {
+    uint8_t clk = digitalRead(ENCODER_CLK);
+    uint8_t dt = digitalRead(ENCODER_DT);
+    encoderState = ((encoderState << 2) | (clk << 1) | dt) & 0x0F;
+    encoderSubSteps += encoderStates[encoderState];
+    if (encoderSubSteps > -ENCODER_STEPS_PER_DETENT && encoderSubSteps < ENCODER_STEPS_PER_DETENT) {
+        return;
+    }
+    int8_t dir = encoderSubSteps > 0 ? 1 : -1;
+    encoderSubSteps = 0;
+    
+    uint8_t head = encoderHead;
+    uint8_t next = (head + 1) & (ENCODER_RING_SIZE - 1);
+    if (next == __atomic_load_n(&encoderTail, __ATOMIC_ACQUIRE)) {
+        encoderOverflows++;
+        return;
+    }
+    encoderRing[head].time = micros();
+    encoderRing[head].dir = dir;
+    __atomic_store_n(&encoderHead, next, __ATOMIC_RELEASE);
+    schedWakeFromISR();
+}
+
+// Factor de aceleración por el intervalo desde el detent anterior (lineal entre lento y
+// rápido)
+static int encoderAccel(uint32_t intervalUs) {
+    if (intervalUs >= ENCODER_ACCEL_SLOW_US) return 1;
+    if (intervalUs <= ENCODER_ACCEL_FAST_US) return ENCODER_ACCEL_MAX;
+    return 1 + (ENCODER_ACCEL_MAX - 1) * (ENCODER_ACCEL_SLOW_US - intervalUs) /
+               (ENCODER_ACCEL_SLOW_US - ENCODER_ACCEL_FAST_US);
+}
+
+// Vaciar el anillo. Girar a la derecha = positivo (el cableado da el signo opuesto).
+EncoderDelta readEncoder() {
+    EncoderDelta delta = {0, 0};
+    uint8_t tail = encoderTail;
+    uint8_t head = __atomic_load_n(&encoderHead, __ATOMIC_ACQUIRE);
+    while (tail != head) {
+        const EncoderEvent& event = encoderRing[tail];
+        int dir = -event.dir;
+        // Un cambio de sentido empieza sin aceleración
+        int factor = (dir == encoderLastDir) ? encoderAccel(event.time - encoderLastDetentUs) : 1;
+        delta.detents += dir;
+        delta.accelerated += dir * factor;
+        encoderLastDetentUs = event.time;
+        encoderLastDir = dir;
+        tail = (tail + 1) & (ENCODER_RING_SIZE - 1);
+    }
+    __atomic_store_n(&encoderTail, tail, __ATOMIC_RELEASE);
+    return delta;
+}
+
+void sampleInputs(unsigned long now) {
+    // En LIVE los pads ya se muestrearon en samplePadInputs()
+    uint16_t buttons = (currentScreen == SCREEN_LIVE) ? sampledButtons : readAllButtons();
+    uint8_t controls = ladder.stable;
+    // LÓGICA INVERTIDA: HIGH = encoder presionado
+    if (digitalRead(ENCODER_SW) == HIGH) controls |= INPUT_ENCODER_SW;
+    
+    input.time = now;
+    input.pressed = buttons & ~input.buttons;
+    input.released = input.buttons & ~buttons;
+    input.buttons = buttons;
+    input.buttonAdc = adcInputs[ADC_IN_BUTTONS].value;
+    input.controlsPressed = ladder.pressed | (controls & ~input.controls & INPUT_ENCODER_SW);
+    input.controlsReleased = ladder.released | (input.controls & ~controls & INPUT_ENCODER_SW);
+    input.controlsClicked = ladder.clicked;
+    input.controlsHeld = ladder.held;
+    input.controls = controls;
+    ladder.pressed = ladder.released = ladder.clicked = ladder.held = 0;
+}
+
 void handleButtons() {
-    uint16_t buttons = readAllButtons();
-    unsigned long currentTime = millis();
+    unsigned long currentTime = input.time;
     
     // Detectar nuevas presiones (flanco de subida)
-    uint16_t newPress = buttons & ~lastButtonState;
+    uint16_t newPress = input.pressed;
+    
+    // LIVE: procesar las pulsaciones en orden con su timestamp de muestreo
+    if (currentScreen == SCREEN_LIVE) {
+        while (padEventTail != padEventHead) {
+            PadEvent& event = padEventQueue[padEventTail];
+            padEventTail = (padEventTail + 1) % PAD_EVENT_QUEUE_SIZE;
+            handleLivePadPress(event.pad, event.time);
+        }
+        newPress = 0;
+    }
     
     // Procesar nuevas presiones
     for (int i = 0; i < 16; i++) {
@@ -1756,22 +3386,7 @@ void handleButtons() {
             buttonPressTime[i] = currentTime;
             lastRepeatTime[i] = currentTime;
             
-            if (currentScreen == SCREEN_LIVE) {
-                // S1-S16: Enviar trigger al MASTER
-                triggerDrum(i);
-                setLED(i, true);
-                ledActive[i] = true;
-                ledOffTime[i] = currentTime + 150;
-                padPressed[i] = true;
-                padPressTime[i] = currentTime;
-                
-                // Redibujar pad con efecto neón
-                drawLivePad(i, true);
-                
-                if (needsFullRedraw) {
-                    drawLiveScreen();
-                }
-            } else if (currentScreen == SCREEN_SETTINGS) {
+            if (currentScreen == SCREEN_SETTINGS) {
                 if (i >= 0 && i < MAX_KITS) {
                     // S1-S3: Cambiar kit (enviar al MASTER)
                     JsonDocument doc;
@@ -1779,7 +3394,7 @@ void handleButtons() {
                     doc["value"] = i;
                     sendUDPCommand(doc);
                     currentKit = i;
-                    drawSettingsScreen();
+                    needsFullRedraw = true;  // Lo dibuja el planificador de render
                 } else if (i == 3) {
                     // S4: (Deshabilitado - antes era Toggle WiFi)
                     // toggleWebServer();  // DESHABILITADO
@@ -1789,184 +3404,343 @@ void handleButtons() {
                     // S5-S7: Cambiar theme (local)
                     int newTheme = i - 4;
                     if (newTheme != currentTheme) {
-                        changeTheme(newTheme - currentTheme);
-                        drawSettingsScreen();
+                        changeTheme(newTheme - currentTheme);  // Marca needsFullRedraw
                     }
+                } else if (i == 8 || i == 9) {
+                    // S9/S10: Swing -/+
+                    changeSwing(i == 8 ? -SWING_STEP : SWING_STEP);
+                    needsFullRedraw = true;
                 }
             } else if (currentScreen == SCREEN_SEQUENCER) {
-                // Permitir edición en tiempo real incluso en play
-                toggleStep(selectedTrack, i);
-                updateStepLEDsForTrack(selectedTrack);
-                needsGridUpdate = true;  // Solo actualizar grid, no full redraw
+                // El toggle se aplica al soltar: mantener + encoder edita la velocity
+                selectedStep = i;
+                stepHoldEdited &= ~(1 << i);
             } else if (currentScreen == SCREEN_PATTERNS) {
                 // S1-S6: Seleccionar patrón (máximo 6 patrones)
                 if (i < 6) {
-                    currentPattern = i;
-                    changePattern(0);  // Enviar al MASTER y solicitar sync
+                    patternCursor = i;
+                    queuePatternChange(i);  // En play se aplica al final del compás
+                    needsFullRedraw = true;
+                    Serial.printf("► Pattern selected: %d\n", i + 1);
+                } else if (i == 6) {
+                    // S7: Cancelar cambio armado
+                    cancelPendingPattern();
                     needsFullRedraw = true;
-                    Serial.printf("► Pattern selected: %d\n", currentPattern + 1);
+                } else if (i == 7) {
+                    // S8: Cuantización del cambio (1 → 2 → 4 compases)
+                    patternSwitchBars = (patternSwitchBars >= 4) ? 1 : patternSwitchBars * 2;
+                    needsFullRedraw = true;
+                    Serial.printf("► Pattern switch quantize: %d bar(s)\n", patternSwitchBars);
                 }
             }
         }
     }
     
-    lastButtonState = buttons;
+    // Flanco de bajada en SEQUENCER: toggle del step (permitido incluso en play),
+    // salvo que se haya editado su velocity mientras estaba mantenido
+    uint16_t newRelease = input.released;
+    if (currentScreen == SCREEN_SEQUENCER && newRelease) {
+        for (int i = 0; i < 16; i++) {
+            if (newRelease & (1 << i)) {
+                if (!(stepHoldEdited & (1 << i))) {
+                    toggleStep(selectedTrack, i);
+                    updateStepLEDsForTrack(selectedTrack);
+                    needsGridUpdate = true;  // Solo actualizar grid, no full redraw
+                }
+                stepHoldEdited &= ~(1 << i);
+            }
+        }
+    }
 }
 
-void handleEncoder() {
-    static bool encoderBtnHeld = false;
-    static unsigned long encoderBtnPressTime = 0;
-    static int menuAccumulator = 0;  // Acumulador para movimientos del menú
-    bool btn = digitalRead(ENCODER_SW);
-    unsigned long currentTime = millis();
-    
-    // Detectar si el botón del encoder está presionado
-    // LÓGICA INVERTIDA: HIGH = presionado (tu encoder específico)
-    if (btn == HIGH && !encoderBtnHeld) {
-        encoderBtnHeld = true;
-        encoderBtnPressTime = currentTime;
-    } else if (btn == LOW) {
-        encoderBtnHeld = false;
+// Muestreo rápido de los pads (tarea cada PAD_SAMPLE_INTERVAL_US, solo en LIVE)
+void samplePadInputs() {
+    if (currentScreen != SCREEN_LIVE) {
+        schedCancel(TASK_PADS);
+        return;
     }
     
-    // isHolding = TRUE solo si está PRESIONADO más de 300ms
-    bool isHolding = encoderBtnHeld && (currentTime - encoderBtnPressTime > 300);
+    uint16_t buttons = readAllButtons();
+    uint16_t newPress = buttons & ~sampledButtons;
+    sampledButtons = buttons;
+    if (!newPress) return;
     
-    // Detectar si el botón BACK está presionado (para BACK+Encoder)
-    int adcValue = analogRead(ANALOG_BUTTONS_PIN);
-    bool backPressed = (adcValue >= BTN_BACK_MIN && adcValue <= BTN_BACK_MAX);
+    unsigned long pressTime = millis();
+    for (int i = 0; i < 16; i++) {
+        if (newPress & (1 << i)) {
+            uint8_t next = (padEventHead + 1) % PAD_EVENT_QUEUE_SIZE;
+            if (next == padEventTail) break;  // Cola llena: descartar
+            padEventQueue[padEventHead].pad = i;
+            padEventQueue[padEventHead].time = pressTime;
+            padEventHead = next;
+        }
+    }
+}
+
+void handleLivePadPress(int pad, unsigned long pressTime) {
+    buttonPressTime[pad] = pressTime;
+    lastRepeatTime[pad] = pressTime;
+    
+    // S1-S16: Enviar trigger al MASTER
+    triggerDrum(pad);
+    setLED(pad, true);
+    armLedOff(pad, pressTime + 150);
+    padPressed[pad] = true;
+    armNoteRepeat(pad, pressTime);
+    
+    if (recordMode && isPlaying) {
+        recordPadHit(pad, pressTime);
+    }
     
-    // Manejar rotación del encoder
-    if (encoderChanged) {
-        encoderChanged = false;
-        int currentPos = encoderPos;
-        int rawDelta = -(currentPos - lastEncoderPos); // Invertido, sin dividir
-        
-        if (rawDelta != 0) {
-            lastEncoderPos = currentPos;
-            
-            // SI ESTÁ EN HOLD: ajustar BPM en cualquier pantalla
-            if (isHolding) {
-                int delta = rawDelta / 2;
-                if (delta != 0) {
-                    tempo = constrain(tempo + delta * 5, MIN_BPM, MAX_BPM);
-                    calculateStepInterval();
-                    needsHeaderUpdate = true;
-                    
-                    // Enviar al MASTER
-                    JsonDocument doc;
-                    doc["cmd"] = "tempo";
-                    doc["value"] = tempo;
-                    sendUDPCommand(doc);
-                    
-                    // Mostrar en TM1638
-                    char display1[9];
-                    snprintf(display1, 9, "BPM %3d ", tempo);
-                    tm1.displayText(display1);
-                    tm2.displayText("        ");
-                    
-                    Serial.printf("► BPM: %d (Encoder Hold) - Sent to MASTER\n", tempo);
-                }
+    // Redibujar pad con efecto neón
+    drawLivePad(pad, true);
+    
+    if (needsFullRedraw) {
+        drawLiveScreen();
+    }
+}
+
+// Step más cercano al instante de la pulsación, según la fase del reloj de steps
+int quantizeToStep(unsigned long pressTime) {
+    long interval = max(1L, (long)stepInterval);
+    long offset = (long)(pressTime - lastStepTime);  // Negativo si el reloj avanzó después de pulsar
+    long stepsAway = (offset >= 0) ? (offset + interval / 2) / interval
+                                   : -((-offset + interval / 2) / interval);
+    
+    // Con swing: elegir entre los vecinos el step cuyo instante real esté más cerca
+    if (recordSwingQuantize) {
+        long best = stepsAway;
+        long bestDist = -1;
+        for (long k = stepsAway - 1; k <= stepsAway + 1; k++) {
+            int step = (int)(((currentStep + k) % MAX_STEPS + MAX_STEPS) % MAX_STEPS);
+            long dist = labs(offset - (k * interval + stepTimingOffset[step]));
+            if (bestDist < 0 || dist < bestDist) {
+                bestDist = dist;
+                best = k;
             }
-            // SIN HOLD: navegación normal según pantalla
-            else {
-                if (currentScreen == SCREEN_MENU) {
-                    // En menú: usar acumulador para movimientos suaves (umbral de 3)
-                    menuAccumulator += rawDelta;
-                    if (abs(menuAccumulator) >= 3) {
-                        int delta = menuAccumulator / 3;
-                        menuAccumulator %= 3;  // Mantener resto
-                        
-                        int oldSelection = menuSelection;
-                        menuSelection += delta;
-                        if (menuSelection < 0) menuSelection = menuItemCount - 1;
-                        if (menuSelection >= menuItemCount) menuSelection = 0;
-                        
-                        // Solo redibujar items que cambiaron
-                        if (oldSelection != menuSelection) {
-                            drawMenuItems(oldSelection, menuSelection);
-                        }
-                        Serial.printf("► Menu: %d\n", menuSelection);
+        }
+        stepsAway = best;
+    }
+    return (int)(((currentStep + stepsAway) % MAX_STEPS + MAX_STEPS) % MAX_STEPS);
+}
+
+void recordPadHit(int track, unsigned long pressTime) {
+    if (recordBatchPattern != currentPattern) {
+        flushRecordBatch();
+        recordBatchPattern = currentPattern;
+    }
+    
+    int step = quantizeToStep(pressTime);
+    Pattern& pattern = patterns[currentPattern];
+    pattern.steps[track][step] = true;
+    setStepVelocity(pattern, track, step,
+                    constrain((liveVelocity() * STEP_VEL_MAX + 63) / 127, STEP_VEL_MIN, STEP_VEL_MAX));
+    recordBatch[track] |= (1 << step);
+    
+    Serial.printf("► REC: Track %d -> Step %d\n", track, step + 1);
+}
+
+// Enviar todos los steps grabados pendientes en un único mensaje
+void flushRecordBatch() {
+    if (recordBatchPattern < 0) return;
+    
+    JsonDocument doc;
+    doc["cmd"] = "stepBatch";
+    doc["pattern"] = recordBatchPattern;
+    JsonArray on = doc["on"].to<JsonArray>();
+    
+    int tracks = 0;
+    for (int t = 0; t < MAX_TRACKS; t++) {
+        if (recordBatch[t]) {
+            // [track, máscara de steps activados, velocity del track en hex]
+            char hex[MAX_STEPS + 1];
+            encodeVelocityTrack(patterns[recordBatchPattern], t, hex);
+            JsonArray entry = on.add<JsonArray>();
+            entry.add(t);
+            entry.add(recordBatch[t]);
+            entry.add(hex);
+            recordBatch[t] = 0;
+            tracks++;
+        }
+    }
+    
+    if (tracks > 0) {
+        sendUDPCommand(doc);
+    }
+    recordBatchPattern = -1;
+}
+
+void toggleRecordMode() {
+    recordMode = !recordMode;
+    if (!recordMode) {
+        flushRecordBatch();
+    }
+    
+    tmDisplayText(0, recordMode ? "REC ON  " : "REC OFF ");
+    tmDisplayText(1, isPlaying ? "        " : "NO PLAY ");
+    deferDisplayCycle();
+    needsHeaderUpdate = true;
+    Serial.printf("► Record mode: %s\n", recordMode ? "ON" : "OFF");
+}
+
+void handleEncoder() {
+    static bool encoderBtnHeld = false;
+    static unsigned long encoderBtnPressTime = 0;
+    unsigned long currentTime = input.time;
+    
+    // Detectar si el botón del encoder está presionado
+    if (input.controlsPressed & INPUT_ENCODER_SW) {
+        encoderBtnHeld = true;
+        encoderBtnPressTime = currentTime;
+    } else if (!(input.controls & INPUT_ENCODER_SW)) {
+        encoderBtnHeld = false;
+    }
+    
+    // isHolding = TRUE solo si está PRESIONADO más de 300ms
+    bool isHolding = encoderBtnHeld && (currentTime - encoderBtnPressTime > 300);
+    
+    // Detectar si el botón BACK está presionado (para BACK+Encoder)
+    bool backPressed = input.controls & INPUT_BACK;
+    bool mutePressed = input.controls & INPUT_MUTE;
+    
+    // Manejar rotación del encoder (detents del anillo de la ISR)
+    EncoderDelta rotation = readEncoder();
+    if (rotation.detents != 0) {
+        // SI ESTÁ EN HOLD: ajustar BPM en cualquier pantalla (con aceleración)
+        if (isHolding) {
+            int delta = rotation.accelerated;
+            if (delta != 0) {
+                tempo = constrain(tempo + delta * BPM_PER_DETENT, MIN_BPM, MAX_BPM);
+                calculateStepInterval();
+                needsHeaderUpdate = true;
+            
+                // Enviar al MASTER
+                JsonDocument doc;
+                doc["cmd"] = "tempo";
+                doc["value"] = tempo;
+                sendUDPCommand(doc);
+            
+                // Mostrar en TM1638
+                char display1[9];
+                snprintf(display1, 9, "BPM %3d ", tempo);
+                tmDisplayText(0, display1);
+                tmDisplayText(1, "        ");
+            
+                Serial.printf("► BPM: %d (Encoder Hold) - Sent to MASTER\n", tempo);
+            }
+        }
+        // SIN HOLD: navegación normal según pantalla
+        else {
+            if (currentScreen == SCREEN_MENU) {
+                // En menú: un item por detent
+                int delta = rotation.detents;
+                if (delta != 0) {
+                    int oldSelection = menuSelection;
+                    menuSelection += delta;
+                    if (menuSelection < 0) menuSelection = menuItemCount - 1;
+                    if (menuSelection >= menuItemCount) menuSelection = 0;
+                
+                    // Solo redibujar items que cambiaron
+                    if (oldSelection != menuSelection) {
+                        drawMenuItems(oldSelection, menuSelection);
                     }
-                    
-                } else if (currentScreen == SCREEN_SETTINGS) {
-                    // En settings: navegar entre opciones (Drum Kits, Themes, etc.)
-                    int delta = rawDelta / 2;
-                    if (delta != 0) {
-                        // Navegar por drum kits con el encoder
-                        changeKit(delta);
-                        Serial.printf("► Kit: %d\n", currentKit);
+                    Serial.printf("► Menu: %d\n", menuSelection);
+                }
+            
+            } else if (currentScreen == SCREEN_SETTINGS) {
+                // En settings: navegar entre opciones (Drum Kits, Themes, etc.)
+                int delta = rotation.detents;
+                if (delta != 0) {
+                    // Navegar por drum kits con el encoder
+                    changeKit(delta);
+                    Serial.printf("► Kit: %d\n", currentKit);
+                }
+            
+            } else if (currentScreen == SCREEN_SETTINGS) {
+                // En settings: navegar entre opciones (Drum Kits, Themes, etc.)
+                int delta = rotation.detents;
+                if (delta != 0) {
+                    // Navegar por drum kits con el encoder
+                    changeKit(delta);
+                    Serial.printf("► Kit: %d\n", currentKit);
+                }
+            
+            } else if (currentScreen == SCREEN_PATTERNS) {
+                // En pantalla de patrones: navegar con encoder
+                int delta = rotation.detents;
+                if (delta != 0) {
+                    int oldCursor = patternCursor;
+                    patternCursor += delta;
+                
+                    // Limitar a 6 patrones (0-5)
+                    if (patternCursor < 0) patternCursor = 5;
+                    if (patternCursor > 5) patternCursor = 0;
+                
+                    if (oldCursor != patternCursor) {
+                        // Redibujar solo los 2 patrones que cambiaron (sin parpadeo)
+                        drawSinglePattern(oldCursor, false);  // Deseleccionar anterior
+                        drawSinglePattern(patternCursor, true);  // Seleccionar nuevo
+                        Serial.printf("► Pattern selected: %d\n", patternCursor + 1);
                     }
-                    
-                } else if (currentScreen == SCREEN_SETTINGS) {
-                    // En settings: navegar entre opciones (Drum Kits, Themes, etc.)
-                    int delta = rawDelta / 2;
-                    if (delta != 0) {
-                        // Navegar por drum kits con el encoder
-                        changeKit(delta);
-                        Serial.printf("► Kit: %d\n", currentKit);
+                }
+            
+            } else if (currentScreen == SCREEN_LIVE) {
+                // En live: velocidad del note repeat (1/8 ... 1/32T)
+                changeRepeatRate(rotation.detents);
+            
+            } else if (currentScreen == SCREEN_SEQUENCER) {
+                // En sequencer: navegación libre entre 16 tracks
+                // La página cambia automáticamente según el track seleccionado
+                int delta = rotation.detents;
+                if (delta != 0 && mutePressed) {
+                    // MUTE + encoder: ◄ deshacer / ► rehacer
+                    muteComboUsed = true;
+                    if (delta < 0) {
+                        undoEdit();
+                    } else {
+                        redoEdit();
                     }
-                    
-                } else if (currentScreen == SCREEN_PATTERNS) {
-                    // En pantalla de patrones: navegar con encoder
-                    int delta = rawDelta / 2;
-                    if (delta != 0) {
-                        int oldPattern = currentPattern;
-                        currentPattern += delta;
-                        
-                        // Limitar a 6 patrones (0-5)
-                        if (currentPattern < 0) currentPattern = 5;
-                        if (currentPattern > 5) currentPattern = 0;
-                        
-                        if (oldPattern != currentPattern) {
-                            // Redibujar solo los 2 patrones que cambiaron (sin parpadeo)
-                            drawSinglePattern(oldPattern, false);  // Deseleccionar anterior
-                            drawSinglePattern(currentPattern, true);  // Seleccionar nuevo
-                            Serial.printf("► Pattern selected: %d\n", currentPattern + 1);
-                        }
+                } else if (delta != 0 && (input.buttons & (1 << selectedStep))) {
+                    // Step mantenido + encoder: editar velocity o microtiming del step
+                    if (stepEditParam == STEP_EDIT_MICRO) {
+                        editStepMicroTiming(selectedStep, delta);
+                    } else {
+                        editStepVelocity(selectedTrack, selectedStep, delta);
                     }
-                    
-                } else if (currentScreen == SCREEN_SEQUENCER) {
-                    // En sequencer: navegación libre entre 16 tracks
-                    // La página cambia automáticamente según el track seleccionado
-                    int delta = rawDelta / 2;
-                    if (delta != 0) {
-                        selectedTrack += delta;
-                        if (selectedTrack < 0) selectedTrack = MAX_TRACKS - 1;
-                        if (selectedTrack >= MAX_TRACKS) selectedTrack = 0;
-                        
-                        // Actualizar página automáticamente según el track
-                        int newPage = selectedTrack / 8;  // 0-7 = página 0, 8-15 = página 1
-                        if (newPage != sequencerPage) {
-                            sequencerPage = newPage;
-                            needsFullRedraw = true;
-                            Serial.printf("► Page changed to: %d/2 (Tracks %d-%d)\n", 
-                                         sequencerPage + 1, sequencerPage * 8 + 1, sequencerPage * 8 + 8);
-                        }
-                        
-                        // Mostrar instrumento en TM1638
-                        showInstrumentOnTM1638(selectedTrack);
-                        
-                        // Actualizar LEDs para mostrar steps del track seleccionado
-                        if (!isPlaying) {
-                            updateStepLEDsForTrack(selectedTrack);
-                        }
-                        
-                        needsHeaderUpdate = true;
-                        Serial.printf("► Track: %d (%s)\n", selectedTrack, trackNames[selectedTrack]);
+                } else if (delta != 0) {
+                    selectedTrack += delta;
+                    if (selectedTrack < 0) selectedTrack = MAX_TRACKS - 1;
+                    if (selectedTrack >= MAX_TRACKS) selectedTrack = 0;
+                
+                    // Actualizar página automáticamente según el track
+                    int newPage = selectedTrack / 8;  // 0-7 = página 0, 8-15 = página 1
+                    if (newPage != sequencerPage) {
+                        sequencerPage = newPage;
+                        needsFullRedraw = true;
+                        Serial.printf("► Page changed to: %d/2 (Tracks %d-%d)\n", 
+                                     sequencerPage + 1, sequencerPage * 8 + 1, sequencerPage * 8 + 8);
                     }
+                
+                    // Mostrar instrumento en TM1638
+                    showInstrumentOnTM1638(selectedTrack);
+                
+                    // Actualizar LEDs para mostrar steps del track seleccionado
+                    if (!isPlaying) {
+                        updateStepLEDsForTrack(selectedTrack);
+                    }
+                
+                    needsHeaderUpdate = true;
+                    Serial.printf("► Track: %d (%s)\n", selectedTrack, trackNames[selectedTrack]);
                 }
             }
         }
     }
     
     // Manejar botón del encoder (solo click corto, no hold)
-    static bool lastBtn = LOW;
     static unsigned long lastBtnTime = 0;
     
     // Detectar click corto (liberación rápida)
-    // LÓGICA INVERTIDA: LOW cuando suelta (HIGH era presionado)
-    if (btn == LOW && lastBtn == HIGH) {
+    if (input.controlsReleased & INPUT_ENCODER_SW) {
         unsigned long pressDuration = currentTime - encoderBtnPressTime;
         
         if (pressDuration < 300 && (currentTime - lastBtnTime > 50)) {
@@ -1984,8 +3758,21 @@ void handleEncoder() {
                 
             } else if (currentScreen == SCREEN_PATTERNS) {
                 // En pantalla de patrones: Enter confirma selección
-                changePattern(0);  // Enviar al MASTER y solicitar sync
-                Serial.printf("► Pattern confirmed: %d\n", currentPattern + 1);
+                queuePatternChange(patternCursor);  // En play se aplica al final del compás
+                needsFullRedraw = true;
+                Serial.printf("► Pattern confirmed: %d\n", patternCursor + 1);
+                
+            } else if (currentScreen == SCREEN_LIVE) {
+                // En live: rampa de velocity del note repeat (off / sube / baja)
+                cycleRepeatRamp();
+                
+            } else if (currentScreen == SCREEN_SEQUENCER && (input.buttons & (1 << selectedStep))) {
+                // Step mantenido: alternar el parámetro del encoder (velocity / microtiming)
+                stepEditParam = (stepEditParam == STEP_EDIT_VELOCITY) ? STEP_EDIT_MICRO : STEP_EDIT_VELOCITY;
+                stepHoldEdited |= (1 << selectedStep);
+                tmDisplayText(0, stepEditParam == STEP_EDIT_MICRO ? "EDIT MIC" : "EDIT VEL");
+                currentDisplayMode = DISPLAY_STEP;
+                armDisplayRevert();
                 
             } else if (currentScreen == SCREEN_SEQUENCER) {
                 // En sequencer: Play/Stop
@@ -1999,24 +3786,22 @@ void handleEncoder() {
             }
         }
     }
-    lastBtn = btn;
 }
 
 void handlePlayStopButton() {
-    static bool lastPlayStopPressed = false;
-    static unsigned long lastPlayStopBtnTime = 0;
-    unsigned long currentTime = millis();
-    
-    int adcValue = analogRead(ANALOG_BUTTONS_PIN);
-    bool playStopPressed = (adcValue >= BTN_PLAY_STOP_MIN && adcValue <= BTN_PLAY_STOP_MAX);
+    bool playStopReleased = input.controlsReleased & INPUT_PLAY_STOP;
     
-    // Detectar flanco de subida (presión)
-    if (playStopPressed && !lastPlayStopPressed) {
-        lastPlayStopBtnTime = currentTime;
+    // Mantener PLAY/STOP durante el play = FILL mientras esté presionado
+    if ((input.controlsHeld & INPUT_PLAY_STOP) && isPlaying && !fillActive) {
+        setFillActive(true);
     }
     
-    // Detectar flanco de bajada (liberación) con debounce
-    if (!playStopPressed && lastPlayStopPressed && (currentTime - lastPlayStopBtnTime > 50)) {
+    // Soltar tras un FILL: no cambiar play/stop
+    if (playStopReleased && fillActive) {
+        setFillActive(false);
+    }
+    // Liberación (el antirrebote ya lo hace la máquina de estados de la escalera)
+    else if (playStopReleased) {
         Serial.printf("► PLAY/STOP BUTTON\n");
         
         // Enviar comando al MASTER
@@ -2025,6 +3810,7 @@ void handlePlayStopButton() {
             doc["cmd"] = "stop";
         } else {
             doc["cmd"] = "start";
+            doc["seed"] = conditionSeed;  // Misma semilla para resolver las condiciones
         }
         sendUDPCommand(doc);
         
@@ -2040,40 +3826,43 @@ void handlePlayStopButton() {
         Serial.printf("   Sequencer: %s\n", isPlaying ? "PLAYING" : "STOPPED");
         needsFullRedraw = true;
     }
-    lastPlayStopPressed = playStopPressed;
 }
 
 void handleMuteButton() {
-    static bool lastMutePressed = false;
     static unsigned long muteBtnPressTime = 0;
-    static bool holdProcessed = false;
-    static int lastMuteAdcValue = 0;
-    unsigned long currentTime = millis();
-    
-    int adcValue = analogRead(ANALOG_BUTTONS_PIN);
-    bool mutePressed = (adcValue >= BTN_MUTE_MIN && adcValue <= BTN_MUTE_MAX);
-    bool noButtonPressed = (adcValue < BTN_NONE_THRESHOLD);
+    unsigned long currentTime = input.time;
+    int adcValue = input.buttonAdc;
     
     // Detectar presión del botón (flanco de subida)
-    if (mutePressed && !lastMutePressed) {
+    if (input.controlsPressed & INPUT_MUTE) {
         muteBtnPressTime = currentTime;
-        holdProcessed = false;
-        lastMuteAdcValue = adcValue;
+        muteComboUsed = false;
         Serial.printf("► MUTE BUTTON PRESSED (ADC: %d)\n", adcValue);
     }
     
-    // Detectar HOLD (mantener presionado >1 segundo) - CLEAR
-    if (mutePressed && !holdProcessed && (currentTime - muteBtnPressTime > 1000)) {
-        holdProcessed = true;
+    // HOLD (mantener MUTE_HOLD_MS) - CLEAR, salvo si se usó MUTE + encoder
+    if ((input.controlsHeld & INPUT_MUTE) && !muteComboUsed) {
         Serial.printf("► MUTE BUTTON (HOLD - CLEAR INSTRUMENT) ADC: %d\n", adcValue);
         
         // Solo funciona en SEQUENCER
         if (currentScreen == SCREEN_SEQUENCER) {
             // Limpiar todos los steps del instrumento seleccionado
             Pattern& pattern = patterns[currentPattern];
+            uint16_t oldMask = trackStepMask(pattern, selectedTrack);
             for (int s = 0; s < MAX_STEPS; s++) {
                 pattern.steps[selectedTrack][s] = false;
             }
+            journalEdit(currentPattern, selectedTrack, oldMask, 0);
+            
+            // Enviar al MASTER como delta (antes el clear solo era local)
+            JsonDocument doc;
+            doc["cmd"] = "stepDelta";
+            doc["pattern"] = currentPattern;
+            doc["track"] = selectedTrack;
+            doc["set"] = 0;
+            doc["clear"] = oldMask;
+            sendUDPCommand(doc);
+            
             Serial.printf("   ✓ Cleared all steps for Track %d (%s)\n", 
                          selectedTrack, trackNames[selectedTrack]);
             
@@ -2082,69 +3871,59 @@ void handleMuteButton() {
             needsFullRedraw = true;
             
             // Feedback visual
-            tm1.displayText("CLEARED ");
-            tm2.displayText(instrumentNames[selectedTrack]);
+            tmDisplayText(0, "CLEARED ");
+            tmDisplayText(1, instrumentNames[selectedTrack]);
         }
     }
     
-    // Detectar liberación del botón - TOGGLE MUTE (solo si fue click corto)
-    if (noButtonPressed && lastMutePressed && !holdProcessed) {
+    // Click (soltado antes del hold) - TOGGLE MUTE
+    if ((input.controlsClicked & INPUT_MUTE) && !muteComboUsed) {
         unsigned long pressDuration = currentTime - muteBtnPressTime;
+        Serial.printf("► MUTE BUTTON (CLICK - TOGGLE MUTE) Duration: %lums\n", pressDuration);
         
-        // Solo toggle mute si la presión fue corta (<1000ms) y mayor que debounce
-        if (pressDuration > 50 && pressDuration < 1000) {
-            Serial.printf("► MUTE BUTTON (CLICK - TOGGLE MUTE) Duration: %lums\n", pressDuration);
+        // Step mantenido + MUTE: cambiar condición del step
+        if (currentScreen == SCREEN_SEQUENCER && (input.buttons & (1 << selectedStep))) {
+            cycleStepCondition(selectedTrack, selectedStep);
+        }
+        // En LIVE: activar/desactivar grabación
+        else if (currentScreen == SCREEN_LIVE) {
+            toggleRecordMode();
+        }
+        // Solo funciona en SEQUENCER
+        else if (currentScreen == SCREEN_SEQUENCER) {
+            // Toggle mute del track seleccionado
+            Pattern& pattern = patterns[currentPattern];
+            pattern.muted[selectedTrack] = !pattern.muted[selectedTrack];
+            
+            Serial.printf("   ✓ Track %d (%s): %s\n", 
+                         selectedTrack, trackNames[selectedTrack],
+                         pattern.muted[selectedTrack] ? "MUTED" : "UNMUTED");
+            
+            // Feedback visual en TM1638
+            if (pattern.muted[selectedTrack]) {
+                tmDisplayText(0, "MUTED  ");
+            } else {
+                tmDisplayText(0, "UNMUTED");
+            }
+            tmDisplayText(1, instrumentNames[selectedTrack]);
             
-            // Solo funciona en SEQUENCER
+            // Actualizar grid para reflejar mute sin parpadeo
             if (currentScreen == SCREEN_SEQUENCER) {
-                // Toggle mute del track seleccionado
-                Pattern& pattern = patterns[currentPattern];
-                pattern.muted[selectedTrack] = !pattern.muted[selectedTrack];
-                
-                Serial.printf("   ✓ Track %d (%s): %s\n", 
-                             selectedTrack, trackNames[selectedTrack],
-                             pattern.muted[selectedTrack] ? "MUTED" : "UNMUTED");
-                
-                // Feedback visual en TM1638
-                if (pattern.muted[selectedTrack]) {
-                    tm1.displayText("MUTED  ");
-                } else {
-                    tm1.displayText("UNMUTED");
-                }
-                tm2.displayText(instrumentNames[selectedTrack]);
-                
-                // Actualizar grid para reflejar mute sin parpadeo
-                if (currentScreen == SCREEN_SEQUENCER) {
-                    needsGridUpdate = true;
-                } else {
-                    needsHeaderUpdate = true;
-                }
+                needsGridUpdate = true;
+            } else {
+                needsHeaderUpdate = true;
             }
         }
     }
-    
-    lastMutePressed = mutePressed;
 }
 
 void handleBackButton() {
-    static bool lastBackPressed = false;
-    static unsigned long lastBackBtnTime = 0;
-    unsigned long currentTime = millis();
-    
-    int adcValue = analogRead(ANALOG_BUTTONS_PIN);
-    bool backPressed = (adcValue >= BTN_BACK_MIN && adcValue <= BTN_BACK_MAX);
-    
-    // Detectar flanco de subida (presión)
-    if (backPressed && !lastBackPressed) {
-        lastBackBtnTime = currentTime;
-    }
-    
-    // Detectar flanco de bajada (liberación) solo si se presionó antes
-    if (!backPressed && lastBackPressed && (currentTime - lastBackBtnTime > 50)) {
+    // Liberación (antirrebote en la máquina de estados de la escalera)
+    if (input.controlsReleased & INPUT_BACK) {
         Serial.printf("► BACK BUTTON\n");
         
         // ATAJO ESPECIAL: BACK + ENCODER PRESIONADO = SYNC PATTERN
-        bool encoderPressed = (digitalRead(ENCODER_SW) == HIGH);
+        bool encoderPressed = input.controls & INPUT_ENCODER_SW;
         if (encoderPressed && currentScreen == SCREEN_SEQUENCER) {
             Serial.println("► ENCODER+BACK = REQUESTING PATTERN SYNC!");
             requestPatternFromMaster();
@@ -2164,59 +3943,52 @@ void handleBackButton() {
             changeScreen(SCREEN_MENU);
         }
     }
-    lastBackPressed = backPressed;
 }
 
+// Mostrar valor ADC (tarea cada ADC_DEBUG_INTERVAL_MS)
 void debugAnalogButtons() {
-    unsigned long currentTime = millis();
+    int adcValue = input.buttonAdc;
     
-    // Mostrar valor ADC cada 200ms
-    if (currentTime - lastButtonDebug > 200) {
-        lastButtonDebug = currentTime;
+    // Solo mostrar si el valor cambió significativamente
+    if (abs(adcValue - lastAdcValue) > 50) {
+        lastAdcValue = adcValue;
         
-        int adcValue = analogRead(ANALOG_BUTTONS_PIN);
+        Serial.printf("\n═══════════════════════════════════\n");
+        Serial.printf("ADC Value: %4d\n", adcValue);
         
-        // Solo mostrar si el valor cambió significativamente
-        if (abs(adcValue - lastAdcValue) > 50) {
-            lastAdcValue = adcValue;
-            
-            Serial.printf("\n═══════════════════════════════════\n");
-            Serial.printf("ADC Value: %4d\n", adcValue);
+        // Determinar qué botón está presionado
+        if (adcValue < BTN_NONE_THRESHOLD || adcValue > 4000) {
+            Serial.println("Status: NO BUTTON PRESSED (pull-up)");
+        }
+        else if (adcValue >= BTN_PLAY_STOP_MIN && adcValue <= BTN_PLAY_STOP_MAX) {
+            Serial.println("Button: PLAY/STOP ✓");
+        }
+        else if (adcValue >= BTN_MUTE_MIN && adcValue <= BTN_MUTE_MAX) {
+            Serial.println("Button: MUTE/CLEAR ✓");
+        }
+        else if (adcValue >= BTN_BACK_MIN && adcValue <= BTN_BACK_MAX) {
+            Serial.println("Button: BACK ✓");
+        }
+        else {
+            Serial.println("Status: ⚠️ VALUE OUT OF RANGE!");
+            Serial.println("\nSuggested action:");
             
-            // Determinar qué botón está presionado
-            if (adcValue < BTN_NONE_THRESHOLD || adcValue > 4000) {
-                Serial.println("Status: NO BUTTON PRESSED (pull-up)");
+            if (adcValue < BTN_PLAY_STOP_MIN) {
+                Serial.printf("  → Lower BTN_PLAY_STOP_MIN to ~%d\n", adcValue - 50);
             }
-            else if (adcValue >= BTN_PLAY_STOP_MIN && adcValue <= BTN_PLAY_STOP_MAX) {
-                Serial.println("Button: PLAY/STOP ✓");
+            else if (adcValue > BTN_PLAY_STOP_MAX && adcValue < BTN_MUTE_MIN) {
+                Serial.printf("  → Adjust: BTN_PLAY_STOP_MAX=%d, BTN_MUTE_MIN=%d\n", 
+                             adcValue + 100, adcValue - 100);
             }
-            else if (adcValue >= BTN_MUTE_MIN && adcValue <= BTN_MUTE_MAX) {
-                Serial.println("Button: MUTE/CLEAR ✓");
+            else if (adcValue > BTN_MUTE_MAX && adcValue < BTN_BACK_MIN) {
+                Serial.printf("  → Adjust: BTN_MUTE_MAX=%d, BTN_BACK_MIN=%d\n", 
+                             adcValue + 100, adcValue - 100);
             }
-            else if (adcValue >= BTN_BACK_MIN && adcValue <= BTN_BACK_MAX) {
-                Serial.println("Button: BACK ✓");
-            }
-            else {
-                Serial.println("Status: ⚠️ VALUE OUT OF RANGE!");
-                Serial.println("\nSuggested action:");
-                
-                if (adcValue < BTN_PLAY_STOP_MIN) {
-                    Serial.printf("  → Lower BTN_PLAY_STOP_MIN to ~%d\n", adcValue - 50);
-                }
-                else if (adcValue > BTN_PLAY_STOP_MAX && adcValue < BTN_MUTE_MIN) {
-                    Serial.printf("  → Adjust: BTN_PLAY_STOP_MAX=%d, BTN_MUTE_MIN=%d\n", 
-                                 adcValue + 100, adcValue - 100);
-                }
-                else if (adcValue > BTN_MUTE_MAX && adcValue < BTN_BACK_MIN) {
-                    Serial.printf("  → Adjust: BTN_MUTE_MAX=%d, BTN_BACK_MIN=%d\n", 
-                                 adcValue + 100, adcValue - 100);
-                }
-                else if (adcValue > BTN_BACK_MAX) {
-                    Serial.printf("  → Raise BTN_BACK_MAX to ~%d\n", adcValue + 100);
-                }
+            else if (adcValue > BTN_BACK_MAX) {
+                Serial.printf("  → Raise BTN_BACK_MAX to ~%d\n", adcValue + 100);
             }
-            Serial.printf("═══════════════════════════════════\n\n");
         }
+        Serial.printf("═══════════════════════════════════\n\n");
     }
 }
 
@@ -2224,37 +3996,47 @@ void handleVolume() {
     static bool lastToggleBtnState = HIGH;
     static int lastPotValue = -1;  // Valor del potenciómetro en el último cambio de modo
     static bool potMoved = true;   // Flag para detectar si el pot se movió después de cambiar modo
+    static bool togglePending = false;  // Flanco visto, a la espera del antirrebote
+    static uint32_t toggleEdgeUs = 0;
     
     // Leer botón toggle (pin 14) con pull-up interno
     bool toggleBtnState = digitalRead(VOLUME_TOGGLE_BTN);
     
-    // Detectar flanco de bajada (botón presionado)
+    // Flanco de bajada (botón presionado): el antirrebote es un plazo de la tarea, no una espera
     if (toggleBtnState == LOW && lastToggleBtnState == HIGH) {
-        delay(50);  // Debounce
-        
-        // Capturar posición actual del potenciómetro
-        int raw = analogRead(ROTARY_ANGLE_PIN);
-        lastPotValue = map(raw, 0, 4095, MAX_VOLUME, 0);
-        potMoved = false;  // El pot NO se ha movido desde el cambio de modo
-        
-        // Alternar modo de volumen
-        volumeMode = (volumeMode == VOL_SEQUENCER) ? VOL_LIVE_PADS : VOL_SEQUENCER;
-        
-        Serial.printf("► Volume Mode: %s (pot locked at %d%% until moved)\n", 
-                     volumeMode == VOL_SEQUENCER ? "SEQUENCER" : "LIVE PADS",
-                     lastPotValue);
-        
-        // Mostrar en TM1638
-        tm1.displayText(volumeMode == VOL_SEQUENCER ? "SEQ VOL " : "PAD VOL ");
-        tm2.displayText("        ");
-        lastDisplayChange = millis();
-        currentDisplayMode = DISPLAY_VOLUME;
-        needsHeaderUpdate = true;
+        togglePending = true;
+        toggleEdgeUs = micros();
+        schedBy(TASK_VOLUME, toggleEdgeUs + VOLUME_DEBOUNCE_MS * 1000UL);
     }
     lastToggleBtnState = toggleBtnState;
     
+    // Sigue pulsado al vencer el plazo: cambio de modo
+    if (togglePending && micros() - toggleEdgeUs >= VOLUME_DEBOUNCE_MS * 1000UL) {
+        togglePending = false;
+        if (toggleBtnState == LOW) {
+            // Capturar posición actual del potenciómetro
+            int raw = adcInputs[ADC_IN_POT].value;
+            lastPotValue = map(raw, 0, 4095, MAX_VOLUME, 0);
+            potMoved = false;  // El pot NO se ha movido desde el cambio de modo
+            
+            // Alternar modo de volumen
+            volumeMode = (volumeMode == VOL_SEQUENCER) ? VOL_LIVE_PADS : VOL_SEQUENCER;
+            
+            Serial.printf("► Volume Mode: %s (pot locked at %d%% until moved)\n", 
+                         volumeMode == VOL_SEQUENCER ? "SEQUENCER" : "LIVE PADS",
+                         lastPotValue);
+            
+            // Mostrar en TM1638
+            tmDisplayText(0, volumeMode == VOL_SEQUENCER ? "SEQ VOL " : "PAD VOL ");
+            tmDisplayText(1, "        ");
+            deferDisplayCycle();
+            currentDisplayMode = DISPLAY_VOLUME;
+            needsHeaderUpdate = true;
+        }
+    }
+    
     // Leer potenciómetro (0-100%)
-    int raw = analogRead(ROTARY_ANGLE_PIN);
+    int raw = adcInputs[ADC_IN_POT].value;
     int newVol = map(raw, 0, 4095, MAX_VOLUME, 0);  // Invertido: girar derecha = subir volumen
     
     // Detectar si el potenciómetro se movió desde el cambio de modo
@@ -2278,7 +4060,7 @@ void handleVolume() {
                 
                 Serial.printf("► Sequencer Volume: %d%%\n", sequencerVolume);
                 showVolumeOnTM1638();
-                lastDisplayChange = millis();
+                deferDisplayCycle();
                 needsHeaderUpdate = true;
             }
         } else {
@@ -2296,7 +4078,7 @@ void handleVolume() {
                 Serial.printf("► Live Pads Volume: %d%% (sent: %d%% +25%% boost)\n", 
                              livePadsVolume, boostedVolume);
                 showVolumeOnTM1638();
-                lastDisplayChange = millis();
+                deferDisplayCycle();
                 needsHeaderUpdate = true;
             }
         }
@@ -2308,14 +4090,14 @@ void handleVolume() {
 // ============================================
 void showInstrumentOnTM1638(int track) {
     lastInstrumentPlayed = track;
-    instrumentDisplayTime = millis();
+    armDisplayRevert();
     currentDisplayMode = DISPLAY_INSTRUMENT;
     
-    tm1.displayText(instrumentNames[track]);
+    tmDisplayText(0, instrumentNames[track]);
     
     char display[9];
     snprintf(display, 9, "TRACK %d ", track + 1);
-    tm2.displayText(display);
+    tmDisplayText(1, display);
 }
 
 void showBPMOnTM1638() {
@@ -2323,8 +4105,8 @@ void showBPMOnTM1638() {
     char display1[9], display2[9];
     snprintf(display1, 9, "BPM %3d ", tempo);
     snprintf(display2, 9, "STEP %2d ", currentStep + 1);
-    tm1.displayText(display1);
-    tm2.displayText(display2);
+    tmDisplayText(0, display1);
+    tmDisplayText(1, display2);
 }
 
 void showVolumeOnTM1638() {
@@ -2339,34 +4121,29 @@ void showVolumeOnTM1638() {
         snprintf(display2, 9, "--------");
     }
     
-    tm1.displayText(display1);
-    tm2.displayText(display2);
+    tmDisplayText(0, display1);
+    tmDisplayText(1, display2);
 }
 
 void updateTM1638Displays() {
-    unsigned long currentTime = millis();
+    // Patrón armado: mostrarlo hasta que se aplique en el fin de compás
+    if (pendingPattern >= 0) {
+        char display1[12], display2[9];
+        snprintf(display1, sizeof(display1), "NEXT P%-2d", (int)constrain(pendingPattern + 1, 1, MAX_PATTERNS));
+        snprintf(display2, 9, "IN %d BAR", barsUntilSwitch);
+        tmDisplayText(0, display1);
+        tmDisplayText(1, display2);
+        return;
+    }
     
-    if (currentDisplayMode == DISPLAY_INSTRUMENT) {
-        if (currentTime - instrumentDisplayTime > 2000) {
-            currentDisplayMode = DISPLAY_BPM;
-            showBPMOnTM1638();
-        }
+    // Hasta que revertInstrumentDisplay() vuelva al BPM
+    if (currentDisplayMode == DISPLAY_INSTRUMENT || currentDisplayMode == DISPLAY_STEP) {
         return;
     }
     
     if (currentScreen == SCREEN_MENU) {
-        tm1.displayText("RED 808 ");
-        tm2.displayText("  MENU  ");
-        
-    } else if (currentScreen == SCREEN_LIVE) {
-        if (currentTime - lastDisplayChange > 3000) {
-            lastDisplayChange = currentTime;
-            if (currentDisplayMode == DISPLAY_BPM) {
-                showVolumeOnTM1638();
-            } else {
-                showBPMOnTM1638();
-            }
-        }
+        tmDisplayText(0, "RED 808 ");
+        tmDisplayText(1, "  MENU  ");
         
     } else if (currentScreen == SCREEN_SEQUENCER) {
         char display1[9], display2[9];
@@ -2376,70 +4153,95 @@ void updateTM1638Displays() {
         } else {
             // Mostrar instrumento completo en ambos displays
             snprintf(display1, 9, "TR %d    ", selectedTrack + 1);
-            tm1.displayText(display1);
-            tm2.displayText(instrumentNames[selectedTrack]);
+            tmDisplayText(0, display1);
+            tmDisplayText(1, instrumentNames[selectedTrack]);
             return; // Salir temprano para no sobrescribir
         }
-        tm1.displayText(display1);
-        tm2.displayText(display2);
+        tmDisplayText(0, display1);
+        tmDisplayText(1, display2);
         
     } else if (currentScreen == SCREEN_SETTINGS) {
         char display1[9];
         snprintf(display1, 9, "KIT  %d  ", currentKit + 1);
-        tm1.displayText(display1);
-        tm2.displayText(kits[currentKit].name.substring(0, 8).c_str());
+        tmDisplayText(0, display1);
+        tmDisplayText(1, kits[currentKit].name.substring(0, 8).c_str());
         
     } else if (currentScreen == SCREEN_DIAGNOSTICS) {
         bool allOk = diagnostic.tftOk && diagnostic.tm1638_1_Ok && 
                      diagnostic.tm1638_2_Ok && diagnostic.encoderOk;
-        tm1.displayText(allOk ? "ALL  OK " : " ERROR  ");
-        tm2.displayText(diagnostic.udpConnected ? "UDP  OK " : "NO  UDP ");
+        tmDisplayText(0, allOk ? "ALL  OK " : " ERROR  ");
+        tmDisplayText(1, diagnostic.udpConnected ? "UDP  OK " : "NO  UDP ");
     }
 }
 
+// Tarea TASK_LED_OFF: apagar los LEDs cuyo plazo venció y armarla para el siguiente
 void updateLEDFeedback() {
     unsigned long currentTime = millis();
     
     for (int i = 0; i < 16; i++) {
         if (ledActive[i]) {
-            if (currentTime >= ledOffTime[i]) {
+            if ((long)(currentTime - ledOffTime[i]) >= 0) {
                 setLED(i, false);
                 ledActive[i] = false;
+            } else {
+                schedBy(TASK_LED_OFF, (uint32_t)(ledOffTime[i] * 1000UL));
             }
         }
     }
 }
 
+void armLedOff(int led, unsigned long offTime) {
+    ledActive[led] = true;
+    ledOffTime[led] = offTime;
+    schedBy(TASK_LED_OFF, (uint32_t)(offTime * 1000UL));
+}
+
+// El texto actual del TM1638 se queda DISPLAY_CYCLE_MS antes de que LIVE lo alterne
+void deferDisplayCycle() {
+    schedAfter(TASK_DISPLAY_CYCLE, DISPLAY_CYCLE_MS * 1000UL);
+}
+
+// Instrumento / edición de step: volver al BPM tras INSTRUMENT_DISPLAY_MS
+void armDisplayRevert() {
+    schedAfter(TASK_DISPLAY_REVERT, INSTRUMENT_DISPLAY_MS * 1000UL);
+}
+
+void revertInstrumentDisplay() {
+    if (currentDisplayMode != DISPLAY_INSTRUMENT && currentDisplayMode != DISPLAY_STEP) return;
+    currentDisplayMode = DISPLAY_BPM;
+    showBPMOnTM1638();
+}
+
+// LIVE: alternar BPM / volumen en el TM1638
+void cycleLiveDisplay() {
+    if (currentScreen != SCREEN_LIVE || pendingPattern >= 0) return;
+    if (currentDisplayMode == DISPLAY_INSTRUMENT || currentDisplayMode == DISPLAY_STEP) return;
+    if (currentDisplayMode == DISPLAY_BPM) {
+        showVolumeOnTM1638();
+    } else {
+        showBPMOnTM1638();
+    }
+}
+
 void updateAudioVisualization() {
-    unsigned long currentTime = millis();
-    
-    if (currentTime - lastVizUpdate > 50) {
-        lastVizUpdate = currentTime;
-        
-        for (int i = 0; i < 8; i++) {
-            if (audioLevels[i] > 0) {
-                audioLevels[i] -= 15;
-                if (audioLevels[i] < 0) audioLevels[i] = 0;
-            }
+    for (int i = 0; i < 8; i++) {
+        if (audioLevels[i] > 0) {
+            audioLevels[i] -= 15;
+            if (audioLevels[i] < 0) audioLevels[i] = 0;
         }
-        
-        // Manejar tremolo y efecto neón en Live Pads
-        if (currentScreen == SCREEN_LIVE) {
-            uint16_t buttons = readAllButtons();
-            for (int i = 0; i < 16; i++) {
-                bool isPressed = buttons & (1 << i);
-                
-                if (isPressed && padPressed[i]) {
-                    // Mantener presionado - Tremolo cada 150ms
-                    if (currentTime - padPressTime[i] > 150) {
-                        triggerDrum(i);
-                        padPressTime[i] = currentTime;
-                    }
-                } else if (!isPressed && padPressed[i]) {
-                    // Se soltó el botón - quitar efecto neón
-                    padPressed[i] = false;
-                    drawLivePad(i, false);
-                }
+    }
+    
+    // Efecto neón en Live Pads
+    if (currentScreen == SCREEN_LIVE) {
+        uint16_t buttons = input.buttons;
+        for (int i = 0; i < 16; i++) {
+            bool isPressed = buttons & (1 << i);
+            
+            // Mantener presionado: lo repite serviceNoteRepeat()
+            if (!isPressed && padPressed[i]) {
+                // Se soltó el botón - quitar efecto neón
+                padPressed[i] = false;
+                drawLivePad(i, false);
             }
         }
     }
@@ -2710,32 +4512,46 @@ void drawSpectrumAnimation() {
 }
 
 void drawMainMenu() {
+    screenClockMs = millis();
     tft.fillScreen(COLOR_BG);
-    
-    tft.fillRect(0, 0, 480, 50, COLOR_NAVY);
-    tft.drawFastHLine(0, 50, 480, COLOR_ACCENT);
+    drawMainMenuTo(tft);
+}
+
+// Menú completo sobre fondo ya limpio (TFT o franja)
+void drawMainMenuTo(TFT_eSPI& g) {
+    drawMainMenuChrome(g);
+    drawMainMenuContent(g);
+}
+
+// Parte fija del menú: barra superior y título
+void drawMainMenuChrome(TFT_eSPI& g) {
+    g.fillRect(0, 0, 480, 50, COLOR_NAVY);
+    g.drawFastHLine(0, 50, 480, COLOR_ACCENT);
     
     // Título
-    tft.setTextSize(4);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(150, 10);
-    tft.println("RED808");
-    
+    g.setTextSize(4);
+    g.setTextColor(COLOR_TEXT);
+    g.setCursor(150, 10);
+    g.println("RED808");
+}
+
+// Parte variable del menú: estado, uptime, RAM e items
+void drawMainMenuContent(TFT_eSPI& g) {
     // Info adicional en header
-    tft.setTextSize(1);
-    tft.setTextColor(udpConnected ? COLOR_SUCCESS : COLOR_ERROR);
-    tft.setCursor(10, 10);
-    tft.print(udpConnected ? "MASTER OK" : "NO MASTER");
+    g.setTextSize(1);
+    g.setTextColor(udpConnected ? COLOR_SUCCESS : COLOR_ERROR);
+    g.setCursor(10, 10);
+    g.print(udpConnected ? "MASTER OK" : "NO MASTER");
     
     // Uptime
-    tft.setTextColor(COLOR_TEXT_DIM);
-    tft.setCursor(10, 23);
-    uint32_t uptimeSeconds = millis() / 1000;
-    tft.printf("UP: %02d:%02d:%02d", uptimeSeconds / 3600, (uptimeSeconds % 3600) / 60, uptimeSeconds % 60);
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.setCursor(10, 23);
+    uint32_t uptimeSeconds = screenClockMs / 1000;
+    g.printf("UP: %02d:%02d:%02d", uptimeSeconds / 3600, (uptimeSeconds % 3600) / 60, uptimeSeconds % 60);
     
     // Memoria
-    tft.setCursor(10, 36);
-    tft.printf("RAM: %dK", ESP.getFreeHeap() / 1024);
+    g.setCursor(10, 36);
+    g.printf("RAM: %dK", ESP.getFreeHeap() / 1024);
     
     int itemHeight = 52;
     int startY = 70;
@@ -2744,18 +4560,18 @@ void drawMainMenu() {
         int y = startY + i * itemHeight;
         
         if (i == menuSelection) {
-            tft.fillRoundRect(30, y, 420, 45, 8, COLOR_ACCENT);
-            tft.drawRoundRect(30, y, 420, 45, 8, COLOR_ACCENT2);
-            tft.setTextSize(3);
-            tft.setTextColor(COLOR_TEXT);
+            g.fillRoundRect(30, y, 420, 45, 8, COLOR_ACCENT);
+            g.drawRoundRect(30, y, 420, 45, 8, COLOR_ACCENT2);
+            g.setTextSize(3);
+            g.setTextColor(COLOR_TEXT);
         } else {
-            tft.fillRoundRect(30, y, 420, 45, 8, COLOR_NAVY_LIGHT);
-            tft.setTextSize(2);
-            tft.setTextColor(COLOR_TEXT_DIM);
+            g.fillRoundRect(30, y, 420, 45, 8, COLOR_NAVY_LIGHT);
+            g.setTextSize(2);
+            g.setTextColor(COLOR_TEXT_DIM);
         }
         
-        tft.setCursor(50, y + (i == menuSelection ? 12 : 14));
-        tft.print(menuItems[i]);
+        g.setCursor(50, y + (i == menuSelection ? 12 : 14));
+        g.print(menuItems[i]);
     }
 }
 
@@ -2764,6 +4580,9 @@ void drawMenuItems(int oldSelection, int newSelection) {
     int itemHeight = 52;
     int startY = 70;
     
+    // Directo al TFT desde este núcleo: que no quede ninguna franja en el bus
+    bandWaitIdle();
+    
     // Redibujar item antiguo (no seleccionado)
     if (oldSelection >= 0 && oldSelection < menuItemCount) {
         int y = startY + oldSelection * itemHeight;
@@ -2787,8 +4606,14 @@ void drawMenuItems(int oldSelection, int newSelection) {
 }
 
 void drawLiveScreen() {
+    screenClockMs = millis();
+    bandWaitIdle();
     tft.fillScreen(COLOR_BG);
-    drawHeader();
+    drawLiveScreenTo(tft);
+}
+
+void drawLiveScreenTo(TFT_eSPI& g) {
+    drawHeaderTo(g, 0);
     
     // ========== 16 PADS EN FORMATO 4x4 CON DISEÑO PROFESIONAL ==========
     const int padW = 110;
@@ -2810,26 +4635,26 @@ void drawLiveScreen() {
         
         // Oscurecer el color para fondo más sutil (reducir brillo 60%)
         uint8_t r = ((baseColor >> 11) & 0x1F) * 5; // Reducir a 40%
-        uint8_t g = ((baseColor >> 5) & 0x3F) * 2;  // Reducir a 40%
+        uint8_t gc = ((baseColor >> 5) & 0x3F) * 2;  // Reducir a 40%
         uint8_t b = (baseColor & 0x1F) * 5;         // Reducir a 40%
-        uint16_t darkColor = tft.color565(r, g, b);
+        uint16_t darkColor = g.color565(r, gc, b);
         
         // Fondo del pad oscuro con borde sutil
-        tft.fillRoundRect(x, y, padW, padH, 5, darkColor);
-        tft.drawRoundRect(x, y, padW, padH, 5, baseColor);
+        g.fillRoundRect(x, y, padW, padH, 5, darkColor);
+        g.drawRoundRect(x, y, padW, padH, 5, baseColor);
         
         // Borde izquierdo con color del instrumento (acento)
-        tft.fillRect(x + 1, y + 1, 3, padH - 2, baseColor);
+        g.fillRect(x + 1, y + 1, 3, padH - 2, baseColor);
         
         // Número del pad (pequeño, arriba izquierda)
-        tft.setTextSize(1);
-        tft.setTextColor(COLOR_TEXT_DIM);
-        tft.setCursor(x + 8, y + 5);
-        tft.printf("%d", i + 1);
+        g.setTextSize(1);
+        g.setTextColor(COLOR_TEXT_DIM);
+        g.setCursor(x + 8, y + 5);
+        g.printf("%d", i + 1);
         
         // Nombre del instrumento (centro, bold)
-        tft.setTextSize(2);
-        tft.setTextColor(COLOR_TEXT);
+        g.setTextSize(2);
+        g.setTextColor(COLOR_TEXT);
         String instName = String(instrumentNames[i]);
         instName.trim();
         if (instName.length() > 6) {
@@ -2837,350 +4662,1319 @@ void drawLiveScreen() {
         }
         // Centrar texto
         int textWidth = instName.length() * 12;
-        tft.setCursor(x + (padW - textWidth) / 2, y + 18);
-        tft.print(instName);
+        g.setCursor(x + (padW - textWidth) / 2, y + 18);
+        g.print(instName);
         
         // Track name abreviado (abajo, pequeño)
-        tft.setTextSize(1);
-        tft.setTextColor(baseColor);
-        tft.setCursor(x + padW - 18, y + padH - 12);
-        tft.print(trackNames[i]);
+        g.setTextSize(1);
+        g.setTextColor(baseColor);
+        g.setCursor(x + padW - 18, y + padH - 12);
+        g.print(trackNames[i]);
     }
     
     // Footer con instrucciones
-    tft.fillRect(0, 302, 480, 18, COLOR_PRIMARY);
-    tft.setTextSize(1);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(30, 307);
-    tft.print("S1-S16: PLAY INSTRUMENTS");
-    tft.setTextColor(COLOR_WARNING);
-    tft.setCursor(230, 307);
-    tft.print("VOLUME: KNOB");
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(360, 307);
-    tft.print("BACK: MENU");
+    g.fillRect(0, 302, 480, 18, COLOR_PRIMARY);
+    g.setTextSize(1);
+    g.setTextColor(COLOR_TEXT);
+    g.setCursor(10, 307);
+    g.print("S1-S16: PLAY INSTRUMENTS");
+    g.setTextColor(COLOR_ERROR);
+    g.setCursor(170, 307);
+    g.print("MUTE: REC");
+    g.setTextColor(COLOR_WARNING);
+    g.setCursor(250, 307);
+    g.print("VOLUME: KNOB");
+    g.setTextColor(COLOR_TEXT);
+    g.setCursor(360, 307);
+    g.print("BACK: MENU");
 }
 
-void drawSequencerScreen() {
-    static int lastStep = -1;
-    
-    if (needsFullRedraw) {
-        tft.fillScreen(COLOR_BG);
-        drawHeader();
-        
-        // Mostrar solo número de página pequeño en la esquina superior derecha
-        tft.setTextSize(1);
-        tft.setTextColor(COLOR_TEXT_DIM);
-        tft.setCursor(10, 58);
-        tft.printf("Page %d/2", sequencerPage + 1);
+// ============================================
+// BANDAS OFF-SCREEN
+// ============================================
+void bandPushTask(void* param) {
+    BandJob job;
+    for (;;) {
+        if (xQueueReceive(bandQueue, &job, portMAX_DELAY) == pdTRUE) {
+            TFT_eSprite& band = bandSprite[job.buf];
+            tft.startWrite();
+            for (int r = 0; r < job.runCount; r++) {
+                if (job.native) {
+                    writeNativeBlock(job.runX[r], job.y, job.runW[r], job.h,
+                                     nativeBand[job.buf] + job.runX[r] * NATIVE_BPP, 480 * NATIVE_BPP);
+                } else {
+                    band.pushSprite(job.runX[r], job.y, job.runX[r], 0, job.runW[r], job.h);
+                }
+            }
+            tft.endWrite();
+            xSemaphoreGive(bandFree[job.buf]);
+        }
     }
-    
-    const int gridX = 8;
-    const int gridY = 88;
-    const int cellW = 27;
-    const int cellH = 24;
-    const int labelW = 38;
-    
-    Pattern& pattern = patterns[currentPattern];
-    
-    // Calcular rango de tracks según página (0-7 o 8-15)
-    int trackStart = sequencerPage * 8;
-    int trackEnd = trackStart + 8;
-    
-    if (needsFullRedraw) {
-        tft.fillRoundRect(gridX - 2, gridY - 2, 468, 210, 8, COLOR_NAVY);
-        
-        tft.setTextSize(1);
-        for (int s = 0; s < MAX_STEPS; s++) {
-            int x = gridX + labelW + s * (cellW + 1);
-            tft.setTextColor((s % 4 == 0) ? COLOR_ACCENT : COLOR_TEXT_DIM);
-            tft.setCursor(x + 6, gridY - 10);
-            tft.printf("%d", (s + 1) % 10);
+}
+
+void setupBandRenderer() {
+#if USE_BAND_RENDER
+    for (int b = 0; b < 2; b++) {
+        bandSprite[b].setColorDepth(16);
+        if (bandSprite[b].createSprite(480, BAND_HEIGHT) == nullptr) {
+            // Sin RAM para los dos buffers: seguir con dibujo directo
+            if (b == 1) bandSprite[0].deleteSprite();
+            Serial.println("  ⚠ Band sprites: no memory, direct drawing");
+            return;
         }
-        
-        tft.setTextSize(2);
-        for (int i = 0; i < 8; i++) {
-            int t = trackStart + i;  // Track real (0-7 o 8-15)
-            int y = gridY + 2 + i * (cellH + 2);
-            
-            // Resaltar track seleccionado con fondo
-            if (t == selectedTrack) {
-                tft.fillRect(gridX, y - 1, labelW - 2, cellH + 2, COLOR_PRIMARY);
+        bandFree[b] = xSemaphoreCreateBinary();
+        xSemaphoreGive(bandFree[b]);
+    }
+    bandQueue = xQueueCreate(2, sizeof(BandJob));
+    // Núcleo 0 (el loop corre en el 1): el envío SPI no bloquea entradas ni UDP
+    xTaskCreatePinnedToCore(bandPushTask, "bandPush", 4096, NULL, 1, NULL, 0);
+    bandRenderEnabled = true;
+    Serial.printf("  ✓ Band sprites: 2 x 480x%d\n", BAND_HEIGHT);
+#if PIXEL_666
+    // Bandas RGB666 para las filas del grid; sin RAM, las filas siguen por los sprites
+    for (int b = 0; b < 2; b++) {
+        nativeBand[b] = (uint8_t*)malloc(480 * BAND_HEIGHT * NATIVE_BPP);
+    }
+    if (nativeBand[0] && nativeBand[1]) {
+        nativeBandsReady = true;
+        Serial.printf("  ✓ Native bands: 2 x 480x%d RGB666\n", BAND_HEIGHT);
+    } else {
+        free(nativeBand[0]);
+        free(nativeBand[1]);
+        nativeBand[0] = nativeBand[1] = nullptr;
+        Serial.println("  ⚠ Native bands: no memory, grid rows via sprites");
+    }
+#endif
+#endif
+}
+
+// RGB565 -> 3 bytes RGB666, los mismos que TFT_eSPI envía al ILI9488 por cada píxel
+static inline void color666(uint16_t color, uint8_t* out) {
+    out[0] = (color & 0xF800) >> 8;
+    out[1] = (color & 0x07E0) >> 3;
+    out[2] = (color & 0x001F) << 3;
+}
+
+// Enviar un bloque RGB666 sin conversión (dentro de startWrite/endWrite): ventana y
+// bytes directos al bus, recortado a la pantalla como pushImage
+void writeNativeBlock(int x, int y, int w, int h, const uint8_t* data, int stride) {
+    if (x + w > tft.width()) w = tft.width() - x;
+    if (y + h > tft.height()) h = tft.height() - y;
+    if (x < 0 || y < 0 || w <= 0 || h <= 0) return;
+    tft.setAddrWindow(x, y, w, h);
+    for (int row = 0; row < h; row++) {
+        tft.getSPIinstance().writeBytes(data + row * stride, w * NATIVE_BPP);
+    }
+}
+
+// Tomar el siguiente sprite libre (espera si aún se está enviando)
+TFT_eSprite& bandAcquire(uint8_t& buf) {
+    buf = bandNext;
+    bandNext ^= 1;
+    xSemaphoreTake(bandFree[buf], portMAX_DELAY);
+    return bandSprite[buf];
+}
+
+void bandSubmit(const BandJob& job) {
+    if (job.runCount == 0) {
+        xSemaphoreGive(bandFree[job.buf]);
+        return;
+    }
+    xQueueSend(bandQueue, &job, portMAX_DELAY);
+}
+
+// Esperar a que no quede ninguna banda en vuelo antes de dibujar directo en el TFT
+void bandWaitIdle() {
+    if (!bandRenderEnabled) return;
+    for (int b = 0; b < 2; b++) {
+        xSemaphoreTake(bandFree[b], portMAX_DELAY);
+        xSemaphoreGive(bandFree[b]);
+    }
+}
+
+// Franjas de pantalla completa: las bandas sirven tal cual; sin ellas, un sprite propio
+// que se envía en el mismo núcleo
+void setupStripRenderer() {
+    if (bandRenderEnabled) {
+        stripRenderEnabled = true;
+        return;
+    }
+    stripSprite.setColorDepth(16);
+    if (stripSprite.createSprite(480, BAND_HEIGHT) == nullptr) {
+        Serial.println("  ⚠ Strip sprite: no memory, direct drawing");
+        return;
+    }
+    stripRenderEnabled = true;
+    Serial.printf("  ✓ Strip sprite: 480x%d\n", BAND_HEIGHT);
+}
+
+// Fondo fijo de cada ChromeScreen dibujado con primitivas (mismo orden que el enum)
+static const ScreenDrawFn CHROME_DRAW[CHROME_COUNT] = {
+    drawMainMenuChrome,
+    drawSettingsChrome,
+    drawDiagnosticsChrome,
+    drawPatternsChrome,
+};
+
+// Componer la franja `strip` de la pantalla (draw pinta la pantalla entera en coordenadas
+// de pantalla; el viewport recorta a la franja) y enviarla. Con chrome, la franja parte
+// del fondo fijo en flash y draw solo pinta la parte variable. Devuelve false tras la última.
+bool composeScreenStrip(int strip, ScreenDrawFn draw, int chrome) {
+    int y = strip * BAND_HEIGHT;
+    int h = min(BAND_HEIGHT, 320 - y);
+    
+    BandJob job = {};
+    TFT_eSprite& band = bandRenderEnabled ? bandAcquire(job.buf) : stripSprite;
+    ChromeCheck* check = (chrome != CHROME_NONE) ? &chromeCheck[chrome][currentTheme] : nullptr;
+    bool fromFlash = check && !check->mismatch && (check->strips & (1 << strip));
+    if (fromFlash) {
+        decodeChromeStrip(band, chrome, strip);
+    } else {
+        band.fillSprite(COLOR_BG);
+    }
+    band.setViewport(0, -y, 480, 320);
+    stripTop = y;
+    stripBottom = y + h;
+    if (check && !fromFlash) {
+        CHROME_DRAW[chrome](band);
+        if (!check->mismatch) {
+            band.resetViewport();   // readPixel() suma el datum del viewport y recorta a él
+            uint32_t diffs = checkChromeStrip(band, chrome, strip);
+            check->strips |= 1 << strip;
+            if (diffs) {
+                check->mismatch = true;
+                Serial.printf("  ⚠ Chrome %d (%s), strip %d: %lu px differ from TFT_eSPI, drawing primitives\n",
+                              chrome, activeTheme->name, strip, (unsigned long)diffs);
+            } else if (check->strips == (1 << STRIP_COUNT) - 1) {
+                Serial.printf("  ✓ Chrome %d (%s) matches TFT_eSPI\n", chrome, activeTheme->name);
             }
-            
-            // Mostrar MUTED con indicador visual claro
-            if (pattern.muted[t]) {
-                tft.setTextColor(COLOR_ERROR);
-                tft.setCursor(gridX + 2, y + 2);
-                tft.print("[M]");
-            } else {
-                // Usar color único por instrumento
-                tft.setTextColor(t == selectedTrack ? TFT_WHITE : getInstrumentColor(t));
-                tft.setCursor(gridX + 4, y + 2);
-                tft.print(trackNames[t]);
+            band.setViewport(0, -y, 480, 320);
+        }
+    }
+    draw(band);
+    stripTop = 0;
+    stripBottom = 320;
+    band.resetViewport();
+    
+    if (bandRenderEnabled) {
+        job.y = y;
+        job.h = h;
+        job.runCount = 1;
+        job.runX[0] = 0;
+        job.runW[0] = 480;
+        bandSubmit(job);
+    } else {
+        band.pushSprite(0, y, 0, 0, 480, h);
+    }
+    return strip + 1 < STRIP_COUNT;
+}
+
+// Descomprimir la franja del fondo fijo: tramos de 16 bits (longitud - 1, índice de paleta)
+// en orden de barrido, partidos al final de cada fila
+void decodeChromeStrip(TFT_eSprite& band, int chrome, int strip) {
+#if CHROME_RLE
+    const ChromeImage& image = CHROME_IMAGES[chrome][currentTheme];
+    const uint16_t* run = image.runs + image.stripStart[strip];
+    const uint16_t* end = image.runs + image.stripStart[strip + 1];
+    int x = 0;
+    int y = 0;
+    for (; run < end; run++) {
+        int len = (*run >> 4) + 1;
+        uint16_t color = image.palette[*run & 0x0F];
+        while (len > 0) {
+            int w = min(len, 480 - x);
+            band.drawFastHLine(x, y, w, color);
+            len -= w;
+            x += w;
+            if (x == 480) {
+                x = 0;
+                y++;
             }
         }
+    }
+#endif
+}
+
+// Píxeles de la franja (ya dibujada con primitivas y sin viewport) que no coinciden con la
+// imagen en flash
+uint32_t checkChromeStrip(TFT_eSprite& band, int chrome, int strip) {
+    uint32_t diffs = 0;
+#if CHROME_RLE
+    const ChromeImage& image = CHROME_IMAGES[chrome][currentTheme];
+    const uint16_t* run = image.runs + image.stripStart[strip];
+    const uint16_t* end = image.runs + image.stripStart[strip + 1];
+    int p = 0;
+    for (; run < end; run++) {
+        uint16_t color = image.palette[*run & 0x0F];
+        for (int len = (*run >> 4) + 1; len > 0; len--, p++) {
+            if (band.readPixel(p % 480, p / 480) != color) diffs++;
+        }
+    }
+#endif
+    return diffs;
+}
+
+// Rasterizar la forma de la celda con las mismas primitivas del TFT (resultado idéntico)
+void setupTileCache() {
+    TFT_eSprite shape = TFT_eSprite(&tft);
+    shape.setColorDepth(16);
+    if (shape.createSprite(TILE_W, TILE_H) == nullptr) {
+        Serial.println("  ⚠ Cell tiles: no memory, drawing primitives");
+        return;
+    }
+    shape.fillSprite(TILE_PX_CORNER);
+    shape.fillRoundRect(0, 0, TILE_W, TILE_H, 3, TILE_PX_FILL);
+    shape.drawRoundRect(0, 0, TILE_W, TILE_H, 3, TILE_PX_BORDER);
+    shape.fillRect(TILE_W - 6, 3, 3, 3, TILE_PX_MARK);
+    for (int py = 0; py < TILE_H; py++) {
+        for (int px = 0; px < TILE_W; px++) {
+            tileShape[py * TILE_W + px] = shape.readPixel(px, py) & 0x03;
+        }
+    }
+    shape.deleteSprite();
+    tileCacheReady = true;
+    Serial.printf("  ✓ Cell tiles: %dx%d atlas (%d bytes)\n", TILE_W, TILE_H, (int)sizeof(tileShape));
+}
+
+// Paleta del tile para un estado: igual que con primitivas, sin borde se ve el relleno
+// y sin condición tampoco hay marca
+static void tilePalette(const CellShadow& cell, uint16_t* palette) {
+    palette[TILE_PX_CORNER] = COLOR_NAVY;
+    palette[TILE_PX_FILL] = cell.color;
+    palette[TILE_PX_BORDER] = (cell.border != COLOR_NAVY) ? cell.border : cell.color;
+    palette[TILE_PX_MARK] = (cell.flags & CELL_FLAG_COND) ? COLOR_BG : cell.color;
+}
+
+// Expandir el tile en tileNative (RGB666, listo para el bus)
+void expandTileNative(const CellShadow& cell) {
+    uint16_t palette[4];
+    uint8_t native[4][NATIVE_BPP];
+    tilePalette(cell, palette);
+    for (int c = 0; c < 4; c++) {
+        color666(palette[c], native[c]);
+    }
+    uint8_t* p = tileNative;
+    for (int i = 0; i < TILE_W * TILE_H; i++, p += NATIVE_BPP) {
+        const uint8_t* c = native[tileShape[i]];
+        p[0] = c[0];
+        p[1] = c[1];
+        p[2] = c[2];
+    }
+}
+
+// Expandir el tile con la paleta del estado y enviarlo en un solo bloque (una ventana)
+// (en el TFT con PIXEL_666, ya en RGB666 y sin conversión por píxel)
+uint32_t drawGridTile(TFT_eSPI& g, int x, int y, const CellShadow& cell) {
+    if (PIXEL_666 && &g == &tft) {
+        expandTileNative(cell);
+        tft.startWrite();
+        writeNativeBlock(x, y, TILE_W, TILE_H, tileNative, TILE_W * NATIVE_BPP);
+        tft.endWrite();
+        return TILE_W * TILE_H;
+    }
+    return drawGridTile565(g, x, y, cell);
+}
+
+// Tile en RGB565 con pushImage (TFT_eSPI convierte cada píxel si el panel es de 18 bits)
+uint32_t drawGridTile565(TFT_eSPI& g, int x, int y, const CellShadow& cell) {
+    uint16_t palette[4];
+    tilePalette(cell, palette);
+    for (int c = 0; c < 4; c++) {
+        palette[c] = (palette[c] >> 8) | (palette[c] << 8);  // pushImage envía en orden de memoria
+    }
+    for (int i = 0; i < TILE_W * TILE_H; i++) {
+        tileBuffer[i] = palette[tileShape[i]];
+    }
+    g.pushImage(x, y, TILE_W, TILE_H, tileBuffer);
+    return TILE_W * TILE_H;
+}
+
+// Fila del grid en la banda RGB565 (sprite): etiqueta si cambió y celdas modificadas;
+// solo se envían esos tramos. Devuelve los píxeles enviados.
+uint32_t composeSpriteGridRow(int bandY, int t, bool labelDirty, const CellShadow* cells, uint16_t dirty) {
+    const int gridX = 8;
+    const int gridY = 88;
+    const int cellW = TILE_W;
+    const int cellH = TILE_H;
+    const int labelW = 38;
+    
+    BandJob job = {};
+    TFT_eSprite& band = bandAcquire(job.buf);
+    band.fillSprite(COLOR_NAVY);
+    for (int s = 0; s < MAX_STEPS; s += 4) {
+        int x = gridX + labelW + s * (cellW + 1);
+        band.drawFastVLine(x - 1, gridY - bandY, 200, COLOR_ACCENT);
+    }
+    job.y = bandY;
+    job.h = BAND_HEIGHT;
+    job.runCount = 0;
+    
+    if (labelDirty) {
+        drawTrackLabel(band, gridX, 0, labelW - 2, cellH + 2, t);
+        job.runX[job.runCount] = gridX;
+        job.runW[job.runCount] = labelW - 2;
+        job.runCount++;
+    }
+    for (int s = 0; s < MAX_STEPS; s++) {
+        if (!(dirty & (1 << s))) continue;
+        int x = gridX + labelW + s * (cellW + 1);
+        drawGridCell(band, x, 1, cellW, cellH, cells[s]);
         
-        lastStep = -1;
+        // Celdas contiguas (ej. playhead anterior y actual) van en un solo tramo
+        int last = job.runCount - 1;
+        if (last >= 0 && job.runX[last] + job.runW[last] + 1 == x) {
+            job.runW[last] += cellW + 1;
+        } else {
+            job.runX[job.runCount] = x;
+            job.runW[job.runCount] = cellW;
+            job.runCount++;
+        }
+    }
+    drawPlayheadRails(band, bandY);
+    uint32_t pixels = 0;
+    for (int r = 0; r < job.runCount; r++) {
+        pixels += (min(480, job.runX[r] + job.runW[r]) - job.runX[r]) * job.h;  // Recortado como el envío
     }
+    bandSubmit(job);
+    return pixels;
+}
+
+// Fila del grid en una banda RGB666: fondo, separadores de compás y tiles de las celdas
+// modificadas, solo en los tramos que se envían. Devuelve los píxeles enviados.
+uint32_t composeNativeGridRow(int bandY, const CellShadow* cells, uint16_t dirty) {
+    const int gridX = 8;
+    const int gridY = 88;
+    const int cellW = TILE_W;
+    const int labelW = 38;
+    const int stride = 480 * NATIVE_BPP;
     
-    // Redibujar etiquetas si cambi\u00f3 el grid (por ejemplo, al mutear)
-    if (needsGridUpdate) {
-        tft.setTextSize(2);
-        for (int i = 0; i < 8; i++) {
-            int t = trackStart + i;  // Track real
-            int y = gridY + 2 + i * (cellH + 2);
-            
-            // Limpiar \u00e1rea de etiqueta
-            tft.fillRect(gridX, y - 1, labelW - 2, cellH + 2, 
-                        (t == selectedTrack) ? COLOR_PRIMARY : COLOR_NAVY);
-            
-            // Redibujar etiqueta con estado actualizado
-            if (pattern.muted[t]) {
-                tft.setTextColor(COLOR_ERROR);
-                tft.setCursor(gridX + 2, y + 2);
-                tft.print("[M]");
-            } else {
-                tft.setTextColor(t == selectedTrack ? TFT_WHITE : getInstrumentColor(t));
-                tft.setCursor(gridX + 4, y + 2);
-                tft.print(trackNames[t]);
-            }
+    BandJob job = {};
+    bandAcquire(job.buf);
+    job.native = true;
+    job.y = bandY;
+    job.h = BAND_HEIGHT;
+    uint8_t* band = nativeBand[job.buf];
+    
+    uint8_t navy[NATIVE_BPP];
+    uint8_t accent[NATIVE_BPP];
+    uint8_t railPx[NATIVE_BPP];
+    color666(COLOR_NAVY, navy);
+    color666(COLOR_ACCENT, accent);
+    
+    for (int s = 0; s < MAX_STEPS; s++) {
+        if (!(dirty & (1 << s))) continue;
+        int x = gridX + labelW + s * (cellW + 1);
+        int last = job.runCount - 1;
+        if (last >= 0 && job.runX[last] + job.runW[last] + 1 == x) {
+            job.runW[last] += cellW + 1;
+        } else {
+            job.runX[job.runCount] = x;
+            job.runW[job.runCount] = cellW;
+            job.runCount++;
         }
     }
     
-    // Dibujar celdas del grid solo para tracks visibles (8 tracks por página)
-    for (int i = 0; i < 8; i++) {
-        int t = trackStart + i;  // Track real (0-7 o 8-15)
-        for (int s = 0; s < MAX_STEPS; s++) {
-            if (needsFullRedraw || needsGridUpdate || (s == currentStep || s == lastStep)) {
-                int x = gridX + labelW + s * (cellW + 1);
-                int y = gridY + 2 + i * (cellH + 2);  // Usar 'i' para posición visual
-                
-                uint16_t color;
-                uint16_t border = COLOR_NAVY;
-                
-                // Si el track está muteado, oscurecer todo
-                bool isMuted = pattern.muted[t];
-                
-                if (isPlaying && s == currentStep) {
-                    // Durante reproducción, usar color del instrumento si está activo
-                    if (isMuted) {
-                        color = pattern.steps[t][s] ? 0x2104 : COLOR_NAVY;  // Gris oscuro si muted
-                        border = COLOR_ERROR;
-                    } else {
-                        color = pattern.steps[t][s] ? getInstrumentColor(t) : COLOR_NAVY_LIGHT;
-                        border = pattern.steps[t][s] ? getInstrumentColor(t) : COLOR_WARNING;
-                    }
-                } else if (pattern.steps[t][s]) {
-                    // Step activo: usar color del instrumento o gris si muted
-                    if (isMuted) {
-                        color = 0x3186;  // Gris medio para indicar muted
-                        border = COLOR_ERROR;
-                    } else {
-                        color = getInstrumentColor(t);
-                        border = getInstrumentColor(t);
-                    }
-                } else {
-                    color = COLOR_NAVY_LIGHT;
-                }
-                
-                tft.fillRoundRect(x, y, cellW, cellH, 3, color);
-                if (border != COLOR_NAVY) {
-                    tft.drawRoundRect(x, y, cellW, cellH, 3, border);
-                }
-                
-                if (s % 4 == 0 && needsFullRedraw) {
-                    tft.drawFastVLine(x - 1, gridY, 200, COLOR_ACCENT);
+    // Fondo de los tramos (el hueco entre celdas contiguas incluido)
+    uint32_t pixels = 0;
+    for (int r = 0; r < job.runCount; r++) {
+        int x0 = job.runX[r];
+        int x1 = min(480, x0 + job.runW[r]);
+        for (int x = x0; x < x1; x++) {
+            int s = (x + 1 - gridX - labelW) / (cellW + 1);
+            bool barLine = ((x + 1 - gridX - labelW) % (cellW + 1) == 0) && (s % 4 == 0);
+            bool rail = playheadDrawn >= 0 &&
+                        (x == playheadRailX(playheadDrawn, 0) || x == playheadRailX(playheadDrawn, 1));
+            uint8_t* p = band + x * NATIVE_BPP;
+            for (int row = 0; row < BAND_HEIGHT; row++, p += stride) {
+                int y = bandY + row;
+                // El separador acaba con el marco del grid (200 px), antes que la última banda
+                const uint8_t* px = (barLine && y >= gridY && y < gridY + 200) ? accent : navy;
+                if (rail && y >= PLAYHEAD_RAIL_Y && y < PLAYHEAD_RAIL_Y + PLAYHEAD_RAIL_H) {
+                    color666(playheadRailColorAt(y), railPx);
+                    px = railPx;
                 }
+                p[0] = px[0];
+                p[1] = px[1];
+                p[2] = px[2];
             }
         }
+        pixels += (x1 - x0) * BAND_HEIGHT;
     }
     
-    lastStep = currentStep;
+    for (int s = 0; s < MAX_STEPS; s++) {
+        if (!(dirty & (1 << s))) continue;
+        int x = gridX + labelW + s * (cellW + 1);
+        expandTileNative(cells[s]);
+        int w = min(cellW, 480 - x);
+        for (int row = 0; row < TILE_H; row++) {
+            memcpy(band + (row + 1) * stride + x * NATIVE_BPP,
+                   tileNative + row * TILE_W * NATIVE_BPP, w * NATIVE_BPP);
+        }
+    }
     
+    bandSubmit(job);
+    return pixels;
+}
+
+// Píxeles por segundo (en millones) de un lote medido en micros
+static float benchMpx(uint32_t pixels, unsigned long us) {
+    return pixels / (float)max(1UL, us);
+}
+
+// Celdas por milisegundo: primitivas frente a tiles, en una banda y en el TFT; en el TFT
+// también tiles y filas del grid en RGB565 (conversión de TFT_eSPI) frente a RGB666
+void benchmarkCellTiles() {
+    if (!tileCacheReady) return;
+    const int cells = 64;
+    const uint32_t tilePixels = cells * TILE_W * TILE_H;
+    CellShadow cell;
+    cell.color = getInstrumentColor(0);
+    cell.border = TFT_WHITE;
+    cell.flags = CELL_FLAG_VALID | CELL_FLAG_COND;
+    
+    for (int target = 0; target < 2; target++) {
+        if (target == 0 && !bandRenderEnabled) continue;
+        TFT_eSPI& g = (target == 0) ? (TFT_eSPI&)bandSprite[0] : tft;
+        
+        unsigned long t0 = micros();
+        for (int i = 0; i < cells; i++) {
+            drawGridCellPrimitives(g, (i % 16) * (TILE_W + 1), 1, TILE_W, TILE_H, cell);
+        }
+        unsigned long t1 = micros();
+        for (int i = 0; i < cells; i++) {
+            drawGridTile565(g, (i % 16) * (TILE_W + 1), 1, cell);
+        }
+        unsigned long t2 = micros();
+        
+        Serial.printf("  ► Cell bench (%s): primitives %.1f cells/ms, tiles %.1f cells/ms (%.2f Mpx/s)\n",
+                     target == 0 ? "sprite" : "TFT",
+                     cells * 1000.0f / max(1UL, t1 - t0), cells * 1000.0f / max(1UL, t2 - t1),
+                     benchMpx(tilePixels, t2 - t1));
+    }
+    
+#if PIXEL_666
+    unsigned long t0 = micros();
+    for (int i = 0; i < cells; i++) {
+        drawGridTile(tft, (i % 16) * (TILE_W + 1), 1, cell);
+    }
+    unsigned long t1 = micros();
+    Serial.printf("  ► Cell bench (TFT RGB666): tiles %.1f cells/ms (%.2f Mpx/s)\n",
+                 cells * 1000.0f / max(1UL, t1 - t0), benchMpx(tilePixels, t1 - t0));
+    
+    if (nativeBandsReady) {
+        // Fila completa del grid: sprite RGB565 frente a banda RGB666 (mismo contenido)
+        const int rows = 8;
+        const uint32_t rowPixels = rows * 480 * BAND_HEIGHT;
+        bandWaitIdle();
+        bandSprite[0].fillSprite(COLOR_NAVY);
+        uint8_t navy[NATIVE_BPP];
+        color666(COLOR_NAVY, navy);
+        for (int i = 0; i < 480 * BAND_HEIGHT; i++) {
+            memcpy(nativeBand[0] + i * NATIVE_BPP, navy, NATIVE_BPP);
+        }
+        t0 = micros();
+        tft.startWrite();
+        for (int r = 0; r < rows; r++) {
+            bandSprite[0].pushSprite(0, r * BAND_HEIGHT);
+        }
+        tft.endWrite();
+        t1 = micros();
+        tft.startWrite();
+        for (int r = 0; r < rows; r++) {
+            writeNativeBlock(0, r * BAND_HEIGHT, 480, BAND_HEIGHT, nativeBand[0], 480 * NATIVE_BPP);
+        }
+        tft.endWrite();
+        unsigned long t2 = micros();
+        Serial.printf("  ► Grid row bench: RGB565 sprite %.2f Mpx/s, RGB666 band %.2f Mpx/s\n",
+                     benchMpx(rowPixels, t1 - t0), benchMpx(rowPixels, t2 - t1));
+    }
+#endif
+    tft.fillScreen(COLOR_BG);
+}
+
+// Etiqueta de track (x, y = esquina del fondo); devuelve píxeles del fondo
+uint32_t drawTrackLabel(TFT_eSPI& g, int x, int y, int w, int h, int t) {
+    g.fillRect(x, y, w, h, (t == selectedTrack) ? COLOR_PRIMARY : COLOR_NAVY);
+    g.setTextSize(2);
+    
+    // Mostrar MUTED con indicador visual claro
+    if (patterns[currentPattern].muted[t]) {
+        g.setTextColor(COLOR_ERROR);
+        g.setCursor(x + 2, y + 3);
+        g.print("[M]");
+    } else {
+        // Usar color único por instrumento
+        g.setTextColor(t == selectedTrack ? TFT_WHITE : getInstrumentColor(t));
+        g.setCursor(x + 4, y + 3);
+        g.print(trackNames[t]);
+    }
+    return w * h;
+}
+
+uint32_t drawGridCell(TFT_eSPI& g, int x, int y, int w, int h, const CellShadow& cell) {
+    if (tileCacheReady && w == TILE_W && h == TILE_H) {
+        return drawGridTile(g, x, y, cell);
+    }
+    return drawGridCellPrimitives(g, x, y, w, h, cell);
+}
+
+uint32_t drawGridCellPrimitives(TFT_eSPI& g, int x, int y, int w, int h, const CellShadow& cell) {
+    uint32_t pixels = w * h;
+    g.fillRoundRect(x, y, w, h, 3, cell.color);
+    if (cell.border != COLOR_NAVY) {
+        g.drawRoundRect(x, y, w, h, 3, cell.border);
+        pixels += 2 * (w + h);
+    }
+    
+    // Marca de step condicional (esquina superior derecha)
+    if (cell.flags & CELL_FLAG_COND) {
+        g.fillRect(x + w - 6, y + 3, 3, 3, COLOR_BG);
+        pixels += 9;
+    }
+    return pixels;
+}
+
+// Estado visual de una celda (color, borde, mute) sin dibujarla; el playhead va aparte
+CellShadow gridCellVisual(const Pattern& pattern, int t, int s) {
+    CellShadow cell;
+    cell.border = COLOR_NAVY;
+    cell.flags = CELL_FLAG_VALID;
+    
+    // Si el track está muteado, oscurecer todo
+    bool isMuted = pattern.muted[t];
+    if (isMuted) cell.flags |= CELL_FLAG_MUTED;
+    
+    if (pattern.steps[t][s]) {
+        // Step activo: brillo según velocity, o gris si muted
+        if (isMuted) {
+            cell.color = 0x3186;  // Gris medio para indicar muted
+            cell.border = COLOR_ERROR;
+        } else {
+            uint8_t level = getStepVelocity(pattern, t, s);
+            cell.color = velocityColor(getInstrumentColor(t), level);
+            cell.border = (level >= STEP_VEL_ACCENT) ? TFT_WHITE : getInstrumentColor(t);
+        }
+    } else {
+        cell.color = COLOR_NAVY_LIGHT;
+    }
+    
+    if (pattern.steps[t][s] && pattern.cond[t][s] != COND_ALWAYS) {
+        cell.flags |= CELL_FLAG_COND;
+    }
+    return cell;
+}
+
+// Columna del carril izquierdo (side 0) o derecho (side 1) del step s
+int playheadRailX(int s, int side) {
+    return 8 + 38 + s * (TILE_W + 1) + (side ? TILE_W : -1);
+}
+
+// Marco del grid bajo un carril: separador de compás (cada 4 steps) o fondo del grid
+static uint16_t playheadBackdrop(int x, int y) {
+    const int gridX = 8;
+    const int gridY = 88;
+    const int labelW = 38;
+    int rel = x + 1 - gridX - labelW;
+    int s = rel / (TILE_W + 1);
+    bool bar = rel >= 0 && rel % (TILE_W + 1) == 0 && s % 4 == 0 && s < MAX_STEPS;
+    return (bar && y >= gridY && y < gridY + 200) ? COLOR_ACCENT : COLOR_NAVY;
+}
+
+// Guardar lo que queda bajo la capa del step s (para reponerlo con pushImage)
+void savePlayheadBacking(int s) {
+    for (int side = 0; side < 2; side++) {
+        int x = playheadRailX(s, side);
+        for (int r = 0; r < PLAYHEAD_RAIL_H; r++) {
+            uint16_t c = playheadBackdrop(x, PLAYHEAD_RAIL_Y + r);
+            playheadBacking[side][r] = (c >> 8) | (c << 8);
+        }
+    }
+    uint16_t bg = (COLOR_BG >> 8) | (COLOR_BG << 8);
+    for (int i = 0; i < TILE_W * PLAYHEAD_MARK_H; i++) {
+        playheadMarkBacking[i] = bg;
+    }
+}
+
+// Tramo de carril de una fila (fila de celdas + hueco): color del instrumento si el trig
+// suena en este loop, apagado si el step está activo pero su condición o el mute lo callan
+static uint16_t playheadTrigColor(int row) {
+    int t = sequencerPage * 8 + row;
+    if (stepTrigMask & (1 << t)) return getInstrumentColor(t);
+    if (patterns[currentPattern].steps[t][currentStep]) return COLOR_TEXT_DIM;
+    return COLOR_WARNING;
+}
+
+// Recalcular los tramos para el step actual; true si alguno cambió
+bool updatePlayheadTrigColors() {
+    bool changed = false;
+    for (int row = 0; row < 8; row++) {
+        uint16_t color = playheadTrigColor(row);
+        if (color != playheadRailColor[row]) {
+            playheadRailColor[row] = color;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+uint16_t playheadRailColorAt(int y) {
+    return playheadRailColor[(y - PLAYHEAD_RAIL_Y) / (TILE_H + 2)];
+}
+
+// Carriles por tramos de fila, desplazados oy filas (bandas)
+static void drawPlayheadRailSegments(TFT_eSPI& g, int s, int oy) {
+    for (int side = 0; side < 2; side++) {
+        for (int row = 0; row < 8;) {
+            // Filas contiguas del mismo color en una sola línea
+            int end = row + 1;
+            while (end < 8 && playheadRailColor[end] == playheadRailColor[row]) end++;
+            int y = PLAYHEAD_RAIL_Y + row * (TILE_H + 2);
+            int h = min(end * (TILE_H + 2), PLAYHEAD_RAIL_H) - row * (TILE_H + 2);
+            g.drawFastVLine(playheadRailX(s, side), y - oy, h, playheadRailColor[row]);
+            row = end;
+        }
+    }
+}
+
+void drawPlayheadOverlay(TFT_eSPI& g, int s) {
+    int x = 8 + 38 + s * (TILE_W + 1);
+    g.fillRect(x, PLAYHEAD_MARK_Y, TILE_W, PLAYHEAD_MARK_H, COLOR_WARNING);
+    drawPlayheadRailSegments(g, s, 0);
+}
+
+// Carriles de la capa en pantalla dentro de una banda de fila (que empieza en bandY),
+// para que enviar tramos de celdas contiguas no los borre
+void drawPlayheadRails(TFT_eSPI& g, int bandY) {
+    if (playheadDrawn < 0) return;
+    drawPlayheadRailSegments(g, playheadDrawn, bandY);
+}
+
+// Mover la capa al step actual (o quitarla en stop): reponer el fondo de la posición
+// anterior y dibujar la nueva. También se repinta en el mismo step si cambia qué trigs
+// suenan (mute). Devuelve los píxeles enviados.
+uint32_t updatePlayheadOverlay() {
+    int target = isPlaying ? currentStep : -1;
+    // Step aún sin evaluar por el reloj (step_update del MASTER): se mueve en el próximo frame
+    if (target >= 0 && clockPrevStep != currentStep) return 0;
+    bool trigChanged = target >= 0 && updatePlayheadTrigColors();
+    if (target == playheadDrawn && !trigChanged) return 0;
+    bandWaitIdle();
+    
+    uint32_t pixels = 0;
+    if (playheadDrawn >= 0) {
+        int x = 8 + 38 + playheadDrawn * (TILE_W + 1);
+        tft.pushImage(x, PLAYHEAD_MARK_Y, TILE_W, PLAYHEAD_MARK_H, playheadMarkBacking);
+        for (int side = 0; side < 2; side++) {
+            tft.pushImage(playheadRailX(playheadDrawn, side), PLAYHEAD_RAIL_Y, 1, PLAYHEAD_RAIL_H,
+                          playheadBacking[side]);
+        }
+        pixels += TILE_W * PLAYHEAD_MARK_H + 2 * PLAYHEAD_RAIL_H;
+    }
+    if (target >= 0) {
+        savePlayheadBacking(target);
+        drawPlayheadOverlay(tft, target);
+        pixels += TILE_W * PLAYHEAD_MARK_H + 2 * PLAYHEAD_RAIL_H;
+    }
+    playheadDrawn = target;
+    return pixels;
+}
+
+// ============================================
+// PLANIFICADOR DE RENDER
+// ============================================
+// Convertir los flags de redibujado en un trabajo de render
+void scheduleRender() {
     if (needsFullRedraw) {
-        tft.setTextSize(1);
-        tft.setTextColor(COLOR_TEXT_DIM);
-        tft.setCursor(5, 305);
-        tft.print("S1-16:TOGGLE | ENC:TRACK | HOLD:BPM | ");
-        tft.setTextColor(COLOR_ACCENT);
-        tft.print("VOL-HOLD:PATTERN");
-        tft.setTextColor(COLOR_TEXT_DIM);
-        tft.print(" | ENCODER+BACK:SYNC");
+        // Un repintado completo sustituye a cualquier trabajo a medias
+        renderJob = {true, true, false, false, 0, renderFrame};
+        needsFullRedraw = false;
+        headerWidgetsValid = false;  // La pantalla nueva puede no tener header
+        needsHeaderUpdate = false;
+        needsGridUpdate = false;
+        return;
+    }
+    if (renderJob.active) return;  // Los flags nuevos esperan al siguiente trabajo
+    
+    bool header = needsHeaderUpdate && currentScreen != SCREEN_MENU;
+    bool grid = needsGridUpdate && currentScreen == SCREEN_SEQUENCER;
+    if (header) needsHeaderUpdate = false;
+    if (grid) needsGridUpdate = false;
+    if (header || grid) {
+        renderJob = {true, false, header, grid, 0, renderFrame};
     }
 }
 
-void drawSettingsScreen() {
-    tft.fillScreen(COLOR_BG);
-    drawHeader();
+// Fondo fijo en flash de cada pantalla (CHROME_NONE = se dibuja entera)
+static int screenChrome(Screen screen) {
+    if (!CHROME_RLE) return CHROME_NONE;
+    switch (screen) {
+        case SCREEN_MENU:
+            return CHROME_MENU;
+        case SCREEN_SETTINGS:
+            return CHROME_SETTINGS;
+        case SCREEN_DIAGNOSTICS:
+            return CHROME_DIAGNOSTICS;
+        case SCREEN_PATTERNS:
+            return CHROME_PATTERNS;
+        default:
+            return CHROME_NONE;
+    }
+}
+
+// Pantallas que se pueden componer por franjas; con fondo fijo, solo su parte variable
+static ScreenDrawFn screenStripFn(Screen screen, bool chrome) {
+    switch (screen) {
+        case SCREEN_MENU:
+            return chrome ? drawMainMenuContent : drawMainMenuTo;
+        case SCREEN_LIVE:
+            return drawLiveScreenTo;
+        case SCREEN_SEQUENCER:
+            return drawSequencerTo;
+        case SCREEN_SETTINGS:
+            return chrome ? drawSettingsContent : drawSettingsTo;
+        case SCREEN_DIAGNOSTICS:
+            return chrome ? drawDiagnosticsContent : drawDiagnosticsScreenTo;
+        case SCREEN_PATTERNS:
+            return chrome ? drawPatternsContent : drawPatternsScreenTo;
+        default:
+            return nullptr;
+    }
+}
+
+// Ejecutar un trozo del trabajo actual; false = trabajo terminado
+static bool runRenderChunk(int chunk) {
+    if (renderJob.full) {
+        // Repintado completo: una pasada de franjas de arriba abajo (un trozo por franja)
+        int chrome = screenChrome(currentScreen);
+        ScreenDrawFn draw = stripRenderEnabled ? screenStripFn(currentScreen, chrome != CHROME_NONE) : nullptr;
+        if (draw) {
+            if (chunk == 0) {
+                screenClockMs = millis();
+                if (currentScreen == SCREEN_SEQUENCER) {
+                    prepareSequencerShadow();
+                }
+            }
+            return composeScreenStrip(chunk, draw, chrome);
+        }
+        
+        switch (currentScreen) {
+            case SCREEN_SEQUENCER:
+                return drawSequencerChunk(chunk, true);
+            case SCREEN_SETTINGS:
+                if (chunk == 0) {
+                    screenClockMs = millis();
+                    tft.fillScreen(COLOR_BG);
+                }
+                return drawSettingsChunk(tft, chunk);
+            case SCREEN_MENU:
+                drawMainMenu();
+                break;
+            case SCREEN_LIVE:
+                drawLiveScreen();
+                break;
+            case SCREEN_DIAGNOSTICS:
+                drawDiagnosticsScreen();
+                break;
+            case SCREEN_PATTERNS:
+                drawPatternsScreen();
+                break;
+            default:
+                break;
+        }
+        return false;
+    }
     
-    // Título principal con badge
-    tft.fillRoundRect(150, 55, 180, 32, 8, COLOR_PRIMARY);
-    tft.drawRoundRect(150, 55, 180, 32, 8, COLOR_ACCENT);
-    tft.setTextSize(2);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(165, 63);
-    tft.print("SETTINGS");
+    if (chunk == 0 && renderJob.header) {
+        updateHeaderWidgets();
+    }
+    if (!renderJob.grid) return false;
+    return drawSequencerChunk(chunk, false);
+}
+
+// Ejecutar trozos hasta agotar el presupuesto (siempre al menos uno para avanzar)
+void runRenderJob() {
+    renderFrame++;
+    if (!renderJob.active) return;
     
-    const int sectionY = 100;
+    if (renderJob.full && renderJob.next == 0) {
+        bandWaitIdle();  // Las pantallas dibujan directo en el TFT
+    }
     
-    // ========== COLUMNA IZQUIERDA: SYSTEM INFO ==========
-    const int leftX = 30;
+    unsigned long start = micros();
+    do {
+        if (renderJob.frame != renderFrame - 1) {
+            renderStats.deferredChunks++;
+        }
+        if (!runRenderChunk(renderJob.next++)) {
+            renderJob.active = false;
+        }
+    } while (renderJob.active && micros() - start < frameBudgetUs);
+    
+    uint32_t elapsed = micros() - start;
+    renderStats.frames++;
+    renderStats.frameUsSum += elapsed;
+    if (elapsed > renderStats.frameUsMax) renderStats.frameUsMax = elapsed;
+    if (elapsed > frameBudgetUs) renderStats.overBudget++;
+    if (renderJob.active) renderStats.deferredFrames++;
+    
+    // Informe cada 64 frames con render (con bandas solo cuenta la composición)
+    if (renderStats.frames >= 64) {
+        Serial.printf("► RENDER: avg %lu us, max %lu us, budget %lu us, over %lu, deferred %lu frames / %lu chunks (%s)\n",
+                     (unsigned long)(renderStats.frameUsSum / renderStats.frames),
+                     (unsigned long)renderStats.frameUsMax, frameBudgetUs,
+                     (unsigned long)renderStats.overBudget,
+                     (unsigned long)renderStats.deferredFrames,
+                     (unsigned long)renderStats.deferredChunks,
+                     bandRenderEnabled ? "bands" : "direct");
+        renderStats = {0, 0, 0, 0, 0, 0};
+    }
+}
+
+void drawSequencerScreen() {
+    for (int chunk = 0; drawSequencerChunk(chunk, needsFullRedraw); chunk++) {}
+}
+
+// SEQUENCER en trozos reanudables: 0 = marco (solo en repintado completo), 1-8 = filas.
+// Devuelve false tras la última fila.
+bool drawSequencerChunk(int chunk, bool full) {
+    static int lastStep = -1;
+    static uint32_t pixels = 0;
+    static int cellsDrawn = 0;
     
-    // Panel System Info
-    tft.fillRoundRect(leftX, sectionY, 200, 28, 6, COLOR_PRIMARY);
-    tft.setTextSize(2);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(leftX + 40, sectionY + 6);
-    tft.print("SYSTEM");
+    const int gridX = 8;
+    const int gridY = 88;
+    const int cellW = 27;
+    const int cellH = 24;
+    const int labelW = 38;
     
-    tft.fillRoundRect(leftX, sectionY + 35, 200, 120, 10, COLOR_PRIMARY);
-    tft.drawRoundRect(leftX, sectionY + 35, 200, 120, 10, COLOR_ACCENT2);
+    Pattern& pattern = patterns[currentPattern];
     
-    int infoY = sectionY + 48;
-    tft.setTextSize(1);
+    // Calcular rango de tracks según página (0-7 o 8-15)
+    int trackStart = sequencerPage * 8;
     
-    // Samplers
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(leftX + 10, infoY);
-    tft.print("SAMPLES:");
-    tft.setTextColor(COLOR_SUCCESS);
-    tft.setCursor(leftX + 100, infoY);
-    tft.print("16 x 16");
-    infoY += 18;
+    if (chunk == 0) {
+        if (full) {
+            bandWaitIdle();
+            tft.fillScreen(COLOR_BG);
+            drawSequencerChrome(tft);
+            
+            // El fondo se acaba de repintar: invalidar la sombra de celdas y etiquetas
+            memset(gridShadow, 0, sizeof(gridShadow));
+            for (int i = 0; i < 8; i++) labelShadow[i] = -1;
+            playheadDrawn = -1;
+            lastStep = -1;
+        }
+        pixels = 0;
+        cellsDrawn = 0;
+        return true;
+    }
     
-    // Memoria
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(leftX + 10, infoY);
-    tft.print("FREE RAM:");
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(leftX + 100, infoY);
-    uint32_t freeHeap = ESP.getFreeHeap();
-    tft.printf("%d KB", freeHeap / 1024);
-    infoY += 18;
+    // Fila visual (chunk - 1): etiqueta y celdas cuyo estado difiere de la sombra
+    int i = chunk - 1;
+    int t = trackStart + i;  // Track real (0-7 o 8-15)
+    int y = gridY + 2 + i * (cellH + 2);  // Usar 'i' para posición visual
     
-    // Firmware
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(leftX + 10, infoY);
-    tft.print("VERSION:");
-    tft.setTextColor(COLOR_WARNING);
-    tft.setCursor(leftX + 100, infoY);
-    tft.print("v5.0");
-    infoY += 18;
-    
-    // Conexión
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(leftX + 10, infoY);
-    tft.print("MASTER:");
-    tft.setTextColor(udpConnected ? COLOR_SUCCESS : COLOR_ERROR);
-    tft.setCursor(leftX + 100, infoY);
-    tft.print(udpConnected ? "ONLINE" : "OFFLINE");
-    infoY += 18;
-    
-    // Pattern
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(leftX + 10, infoY);
-    tft.print("PATTERN:");
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(leftX + 100, infoY);
-    tft.printf("%d / %d", currentPattern + 1, MAX_PATTERNS);
-    infoY += 18;
+    int16_t label = t | (pattern.muted[t] ? 0x100 : 0) | (t == selectedTrack ? 0x200 : 0);
+    bool labelDirty = (label != labelShadow[i]);
+    labelShadow[i] = label;
     
-    // Uptime
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(leftX + 10, infoY);
-    tft.print("UPTIME:");
-    tft.setTextColor(COLOR_TEXT_DIM);
-    tft.setCursor(leftX + 100, infoY);
-    uint32_t uptimeSeconds = millis() / 1000;
-    uint32_t hours = uptimeSeconds / 3600;
-    uint32_t minutes = (uptimeSeconds % 3600) / 60;
-    tft.printf("%02d:%02d", hours, minutes);
+    CellShadow cells[MAX_STEPS];
+    uint16_t dirty = 0;
+    for (int s = 0; s < MAX_STEPS; s++) {
+        cells[s] = gridCellVisual(pattern, t, s);
+        CellShadow& shadow = gridShadow[i][s];
+        if (cells[s].color != shadow.color || cells[s].border != shadow.border ||
+            cells[s].flags != shadow.flags) {
+            dirty |= (1 << s);
+            shadow = cells[s];
+        }
+    }
+    
+    if (labelDirty || dirty) {
+        if (nativeBandsReady && !labelDirty) {
+            // Solo celdas: la fila se compone ya en RGB666 y se envía sin conversión
+            pixels += composeNativeGridRow(y - 1, cells, dirty);
+            cellsDrawn += __builtin_popcount(dirty);
+        } else if (bandRenderEnabled) {
+            pixels += composeSpriteGridRow(y - 1, t, labelDirty, cells, dirty);
+            cellsDrawn += __builtin_popcount(dirty);
+        } else {
+            if (labelDirty) {
+                pixels += drawTrackLabel(tft, gridX, y - 1, labelW - 2, cellH + 2, t);
+            }
+            for (int s = 0; s < MAX_STEPS; s++) {
+                if (!(dirty & (1 << s))) continue;
+                int x = gridX + labelW + s * (cellW + 1);
+                pixels += drawGridCell(tft, x, y, cellW, cellH, cells[s]);
+                cellsDrawn++;
+            }
+        }
+    }
+    
+    if (i < 7) {
+        return true;
+    }
+    
+    // Tras las filas: mover la capa del playhead (unos cientos de píxeles, sin tocar celdas)
+    pixels += updatePlayheadOverlay();
+    
+    // Estadística: píxeles enviados por step frente al repintado completo anterior
+    gridPixelsPushed = pixels;
+    if (currentStep != lastStep && !full) {
+        gridPixelsStepSum += pixels;
+        gridPixelsStepFrames++;
+        if (currentStep == 0) {
+            const uint32_t fullRepaint = 8 * MAX_STEPS * (cellW * cellH + 2 * (cellW + cellH)) +
+                                         8 * (labelW - 2) * (cellH + 2);
+            Serial.printf("► GRID: %lu px/step avg (%d cells last), full repaint %lu px\n",
+                         (unsigned long)(gridPixelsStepSum / gridPixelsStepFrames), cellsDrawn,
+                         (unsigned long)fullRepaint);
+            gridPixelsStepSum = 0;
+            gridPixelsStepFrames = 0;
+        }
+    }
+    
+    lastStep = currentStep;
+    return false;
+}
+
+// Marco del SEQUENCER (header, página, números de step, fondo del grid, footer)
+void drawSequencerChrome(TFT_eSPI& g) {
+    const int gridX = 8;
+    const int gridY = 88;
+    const int cellW = 27;
+    const int labelW = 38;
+    
+    drawHeaderTo(g, 0);
+    
+    // Mostrar solo número de página pequeño en la esquina superior derecha
+    g.setTextSize(1);
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.setCursor(10, 58);
+    g.printf("Page %d/2", sequencerPage + 1);
+    
+    g.setCursor(5, 305);
+    g.print("S1-16:TOGGLE | ENC:TRACK | HOLD:BPM | ");
+    g.setTextColor(COLOR_ACCENT);
+    g.print("VOL-HOLD:PATTERN");
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.print(" | ENCODER+BACK:SYNC");
+    
+    g.fillRoundRect(gridX - 2, gridY - 2, 468, 210, 8, COLOR_NAVY);
+    
+    g.setTextSize(1);
+    for (int s = 0; s < MAX_STEPS; s++) {
+        int x = gridX + labelW + s * (cellW + 1);
+        g.setTextColor((s % 4 == 0) ? COLOR_ACCENT : COLOR_TEXT_DIM);
+        g.setCursor(x + 6, gridY - 10);
+        g.printf("%d", (s + 1) % 10);
+    }
+    
+    // Separadores de tiempo (cada 4 steps)
+    for (int s = 0; s < MAX_STEPS; s += 4) {
+        int x = gridX + labelW + s * (cellW + 1);
+        g.drawFastVLine(x - 1, gridY, 200, COLOR_ACCENT);
+    }
+}
+
+// Estado objetivo del grid para un repintado completo por franjas: la sombra queda igual a
+// lo que se envía, así el siguiente repintado incremental compara contra la pantalla real
+void prepareSequencerShadow() {
+    Pattern& pattern = patterns[currentPattern];
+    int trackStart = sequencerPage * 8;
+    for (int i = 0; i < 8; i++) {
+        int t = trackStart + i;
+        labelShadow[i] = t | (pattern.muted[t] ? 0x100 : 0) | (t == selectedTrack ? 0x200 : 0);
+        for (int s = 0; s < MAX_STEPS; s++) {
+            gridShadow[i][s] = gridCellVisual(pattern, t, s);
+        }
+    }
+    playheadDrawn = isPlaying ? currentStep : -1;
+    if (playheadDrawn >= 0) {
+        savePlayheadBacking(playheadDrawn);
+        updatePlayheadTrigColors();
+    }
+}
+
+// SEQUENCER completo en una franja: celdas desde la sombra, solo las filas que la cruzan
+void drawSequencerTo(TFT_eSPI& g) {
+    const int gridX = 8;
+    const int gridY = 88;
+    const int cellW = 27;
+    const int cellH = 24;
+    const int labelW = 38;
     
-    // ========== COLUMNA DERECHA: THEMES ==========
+    drawSequencerChrome(g);
+    
+    int trackStart = sequencerPage * 8;
+    for (int i = 0; i < 8; i++) {
+        int y = gridY + 2 + i * (cellH + 2);
+        if (y - 1 >= stripBottom || y + cellH + 1 <= stripTop) continue;
+        drawTrackLabel(g, gridX, y - 1, labelW - 2, cellH + 2, trackStart + i);
+        for (int s = 0; s < MAX_STEPS; s++) {
+            int x = gridX + labelW + s * (cellW + 1);
+            drawGridCell(g, x, y, cellW, cellH, gridShadow[i][s]);
+        }
+    }
+    if (playheadDrawn >= 0) {
+        drawPlayheadOverlay(g, playheadDrawn);
+    }
+}
+
+void drawSettingsScreen() {
+    screenClockMs = millis();
+    tft.fillScreen(COLOR_BG);
+    drawSettingsTo(tft);
+}
+
+void drawSettingsTo(TFT_eSPI& g) {
+    for (int chunk = 0; drawSettingsChunk(g, chunk); chunk++) {}
+}
+
+// SETTINGS en trozos reanudables: título, columna SYSTEM, THEMES, swing/WiFi/footer.
+// Dibuja sobre fondo ya limpio; devuelve false tras el último trozo.
+bool drawSettingsChunk(TFT_eSPI& g, int chunk) {
+    drawSettingsPartChrome(g, chunk);
+    drawSettingsPartContent(g, chunk);
+    return chunk < 3;
+}
+
+void drawSettingsChrome(TFT_eSPI& g) {
+    for (int part = 0; part < 4; part++) drawSettingsPartChrome(g, part);
+}
+
+void drawSettingsContent(TFT_eSPI& g) {
+    for (int part = 0; part < 4; part++) drawSettingsPartContent(g, part);
+}
+
+// Parte fija de cada trozo (solo depende del tema)
+void drawSettingsPartChrome(TFT_eSPI& g, int part) {
+    const int sectionY = 100;
+    const int leftX = 30;     // Columna izquierda: SYSTEM INFO
+    const int rightX = 250;   // Columna derecha: THEMES
+    
+    if (part == 0) {
+        // Título principal con badge
+        g.fillRoundRect(150, 55, 180, 32, 8, COLOR_PRIMARY);
+        g.drawRoundRect(150, 55, 180, 32, 8, COLOR_ACCENT);
+        g.setTextSize(2);
+        g.setTextColor(COLOR_TEXT);
+        g.setCursor(165, 63);
+        g.print("SETTINGS");
+    } else if (part == 1) {
+        // Panel System Info
+        g.fillRoundRect(leftX, sectionY, 200, 28, 6, COLOR_PRIMARY);
+        g.setTextSize(2);
+        g.setTextColor(COLOR_TEXT);
+        g.setCursor(leftX + 40, sectionY + 6);
+        g.print("SYSTEM");
+        
+        g.fillRoundRect(leftX, sectionY + 35, 200, 120, 10, COLOR_PRIMARY);
+        g.drawRoundRect(leftX, sectionY + 35, 200, 120, 10, COLOR_ACCENT2);
+        
+        const char* labels[] = {"SAMPLES:", "FREE RAM:", "VERSION:", "MASTER:", "PATTERN:", "UPTIME:"};
+        g.setTextSize(1);
+        g.setTextColor(COLOR_ACCENT2);
+        for (int i = 0; i < 6; i++) {
+            g.setCursor(leftX + 10, sectionY + 48 + i * 18);
+            g.print(labels[i]);
+        }
+    } else if (part == 2) {
+        // Panel Themes
+        g.fillRoundRect(rightX, sectionY, 200, 28, 6, COLOR_PRIMARY);
+        g.setTextSize(2);
+        g.setTextColor(COLOR_TEXT);
+        g.setCursor(rightX + 40, sectionY + 6);
+        g.print("THEMES");
+    } else {
+        // Caja de SWING (el valor va encima)
+        g.fillRoundRect(leftX, sectionY + 165, 200, 32, 6, COLOR_PRIMARY);
+        g.drawRoundRect(leftX, sectionY + 165, 200, 32, 6, COLOR_ACCENT2);
+    }
+}
+
+// Parte variable de cada trozo: header, valores, selector de tema, swing, WiFi y footer
+// (el footer va aquí porque tapa el borde inferior de la caja WiFi)
+void drawSettingsPartContent(TFT_eSPI& g, int part) {
+    const int sectionY = 100;
+    const int leftX = 30;
     const int rightX = 250;
     
-    // Panel Themes
-    tft.fillRoundRect(rightX, sectionY, 200, 28, 6, COLOR_PRIMARY);
-    tft.setTextSize(2);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(rightX + 40, sectionY + 6);
-    tft.print("THEMES");
+    if (part == 0) {
+        drawHeaderTo(g, 0);
+        return;
+    }
     
-    // Theme selector (4 themes en 2x2)
-    for (int i = 0; i < THEME_COUNT; i++) {
-        const ColorTheme* theme = THEMES[i];
-        int col = i % 2;
-        int row = i / 2;
-        int x = rightX + 20 + col * 80;
-        int y = sectionY + 48 + row * 55;
+    if (part == 1) {
+        int infoY = sectionY + 48;
+        g.setTextSize(1);
+        
+        // Samplers
+        g.setTextColor(COLOR_SUCCESS);
+        g.setCursor(leftX + 100, infoY);
+        g.print("16 x 16");
+        infoY += 18;
+        
+        // Memoria
+        g.setTextColor(COLOR_TEXT);
+        g.setCursor(leftX + 100, infoY);
+        uint32_t freeHeap = ESP.getFreeHeap();
+        g.printf("%d KB", freeHeap / 1024);
+        infoY += 18;
+        
+        // Firmware
+        g.setTextColor(COLOR_WARNING);
+        g.setCursor(leftX + 100, infoY);
+        g.print("v5.0");
+        infoY += 18;
+        
+        // Conexión
+        g.setTextColor(udpConnected ? COLOR_SUCCESS : COLOR_ERROR);
+        g.setCursor(leftX + 100, infoY);
+        g.print(udpConnected ? "ONLINE" : "OFFLINE");
+        infoY += 18;
+        
+        // Pattern
+        g.setTextColor(COLOR_TEXT);
+        g.setCursor(leftX + 100, infoY);
+        g.printf("%d / %d", currentPattern + 1, MAX_PATTERNS);
+        infoY += 18;
         
-        if (i == currentTheme) {
-            tft.fillRoundRect(x - 3, y - 3, 66, 48, 6, COLOR_ACCENT);
+        // Uptime
+        g.setTextColor(COLOR_TEXT_DIM);
+        g.setCursor(leftX + 100, infoY);
+        uint32_t uptimeSeconds = screenClockMs / 1000;
+        uint32_t hours = uptimeSeconds / 3600;
+        uint32_t minutes = (uptimeSeconds % 3600) / 60;
+        g.printf("%02d:%02d", hours, minutes);
+        return;
+    }
+    
+    if (part == 2) {
+        // Theme selector (4 themes en 2x2)
+        for (int i = 0; i < THEME_COUNT; i++) {
+            const ColorTheme* theme = THEMES[i];
+            int col = i % 2;
+            int row = i / 2;
+            int x = rightX + 20 + col * 80;
+            int y = sectionY + 48 + row * 55;
+            
+            if (i == currentTheme) {
+                g.fillRoundRect(x - 3, y - 3, 66, 48, 6, COLOR_ACCENT);
+            }
+            
+            g.fillRoundRect(x, y, 60, 42, 5, theme->primary);
+            g.drawRoundRect(x, y, 60, 42, 5, theme->accent);
+            
+            // Indicador de color
+            g.fillCircle(x + 30, y + 15, 10, theme->accent);
+            
+            // Label
+            g.setTextSize(1);
+            g.setTextColor(i == currentTheme ? COLOR_ACCENT : COLOR_TEXT_DIM);
+            g.setCursor(x + 5, y + 32);
+            String label = String(theme->name);
+            if (label.length() > 7) label = label.substring(0, 7);
+            g.print(label);
         }
-        
-        tft.fillRoundRect(x, y, 60, 42, 5, theme->primary);
-        tft.drawRoundRect(x, y, 60, 42, 5, theme->accent);
-        
-        // Indicador de color
-        tft.fillCircle(x + 30, y + 15, 10, theme->accent);
-        
-        // Label
-        tft.setTextSize(1);
-        tft.setTextColor(i == currentTheme ? COLOR_ACCENT : COLOR_TEXT_DIM);
-        tft.setCursor(x + 5, y + 32);
-        String label = String(theme->name);
-        if (label.length() > 7) label = label.substring(0, 7);
-        tft.print(label);
+        return;
     }
     
+    // ========== SWING ==========
+    g.setTextSize(2);
+    g.setTextColor(swingAmount > SWING_MIN ? COLOR_WARNING : COLOR_TEXT);
+    g.setCursor(leftX + 25, sectionY + 173);
+    g.printf("SWING: %d%%", swingAmount);
+    
     // ========== WIFI STATUS ==========
     const int wifiY = sectionY + 165;
     
-    tft.fillRoundRect(rightX, wifiY, 200, 32, 6, webServerEnabled ? COLOR_SUCCESS : COLOR_ERROR);
-    tft.setTextSize(2);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(rightX + 40, wifiY + 8);
-    tft.print("WiFi: ");
-    tft.print(webServerEnabled ? "ON" : "OFF");
+    g.fillRoundRect(rightX, wifiY, 200, 32, 6, webServerEnabled ? COLOR_SUCCESS : COLOR_ERROR);
+    g.setTextSize(2);
+    g.setTextColor(COLOR_TEXT);
+    g.setCursor(rightX + 40, wifiY + 8);
+    g.print("WiFi: ");
+    g.print(webServerEnabled ? "ON" : "OFF");
     
     // Footer con instrucciones
-    tft.fillRect(0, 295, 480, 25, COLOR_PRIMARY);
-    tft.fillRect(0, 295, 480, 2, COLOR_ACCENT);
-    tft.setTextSize(1);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(10, 305);
-    tft.print("S4:WiFi");
-    tft.setTextColor(COLOR_TEXT_DIM);
-    tft.print(" | ");
-    tft.setTextColor(COLOR_TEXT);
-    tft.print("S5-S7:Theme");
-    tft.setTextColor(COLOR_TEXT_DIM);
-    tft.print(" | ");
-    tft.setTextColor(COLOR_ACCENT);
-    tft.print("BACK:Menu");
+    g.fillRect(0, 295, 480, 25, COLOR_PRIMARY);
+    g.fillRect(0, 295, 480, 2, COLOR_ACCENT);
+    g.setTextSize(1);
+    g.setTextColor(COLOR_TEXT);
+    g.setCursor(10, 305);
+    g.print("S4:WiFi");
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.print(" | ");
+    g.setTextColor(COLOR_TEXT);
+    g.print("S5-S7:Theme");
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.print(" | ");
+    g.setTextColor(COLOR_TEXT);
+    g.print("S9/S10:Swing");
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.print(" | ");
+    g.setTextColor(COLOR_ACCENT);
+    g.print("BACK:Menu");
 }
 
 void drawDiagnosticsScreen() {
+    screenClockMs = millis();
     tft.fillScreen(COLOR_BG);
-    drawHeader();
+    drawDiagnosticsScreenTo(tft);
+}
+
+void drawDiagnosticsScreenTo(TFT_eSPI& g) {
+    drawDiagnosticsChrome(g);
+    drawDiagnosticsContent(g);
+}
+
+static const char* const DIAG_ITEMS[] = {
+    "TFT DISPLAY", 
+    "TM1638 #1 (S1-8)", 
+    "TM1638 #2 (S9-16)", 
+    "ROTARY ENCODER",
+    "WiFi CONNECTION",
+    "UDP -> MASTER"
+};
+static const int DIAG_TOP = 88;
+static const int DIAG_LINE_HEIGHT = 34;
+static const int DIAG_NET_Y = DIAG_TOP + 6 * DIAG_LINE_HEIGHT + 8;
+
+// Parte fija de DIAGNOSTICS: título, filas, etiquetas y panel de red
+void drawDiagnosticsChrome(TFT_eSPI& g) {
+    g.setTextSize(2);
+    g.setTextColor(COLOR_ACCENT2);
+    g.setCursor(160, 58);
+    g.println("DIAGNOSTICS");
+    
+    for (int i = 0; i < 6; i++) {
+        int y = DIAG_TOP + i * DIAG_LINE_HEIGHT;
+        g.fillRoundRect(32, y + 2, 416, 28, 6, COLOR_NAVY);
+        g.fillRoundRect(30, y, 416, 28, 6, COLOR_NAVY_LIGHT);
+        
+        g.setTextSize(2);
+        g.setTextColor(COLOR_TEXT);
+        g.setCursor(70, y + 6);
+        g.print(DIAG_ITEMS[i]);
+    }
+    
+    // Panel de información de red
+    g.fillRoundRect(30, DIAG_NET_Y, 420, 50, 6, COLOR_NAVY);
+    g.setTextSize(1);
+    g.setTextColor(COLOR_ACCENT2);
+    g.setCursor(45, DIAG_NET_Y + 5);
+    g.println("NETWORK INFO:");
+    
+    g.setTextSize(1);
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.setCursor(180, 305);
+    g.println("BACK: MENU");
+}
+
+// Parte variable de DIAGNOSTICS: header, indicadores, OK/ERR y datos de red
+void drawDiagnosticsContent(TFT_eSPI& g) {
+    drawHeaderTo(g, 0);
     
-    tft.setTextSize(2);
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(160, 58);
-    tft.println("DIAGNOSTICS");
-    
-    int y = 88;
-    const int lineHeight = 34;
-    
-    const char* items[] = {
-        "TFT DISPLAY", 
-        "TM1638 #1 (S1-8)", 
-        "TM1638 #2 (S9-16)", 
-        "ROTARY ENCODER",
-        "WiFi CONNECTION",
-        "UDP -> MASTER"
-    };
     bool status[] = {
         diagnostic.tftOk,
         diagnostic.tm1638_1_Ok,
@@ -3191,121 +5985,198 @@ void drawDiagnosticsScreen() {
     };
     
     for (int i = 0; i < 6; i++) {
-        tft.fillRoundRect(32, y + 2, 416, 28, 6, COLOR_NAVY);
-        tft.fillRoundRect(30, y, 416, 28, 6, COLOR_NAVY_LIGHT);
-        
+        int y = DIAG_TOP + i * DIAG_LINE_HEIGHT;
         uint16_t indicatorColor = status[i] ? COLOR_SUCCESS : COLOR_ERROR;
-        tft.fillCircle(50, y + 14, 7, indicatorColor);
-        tft.drawCircle(50, y + 14, 8, indicatorColor);
-        
-        tft.setTextSize(2);
-        tft.setTextColor(COLOR_TEXT);
-        tft.setCursor(70, y + 6);
-        tft.print(items[i]);
-        
-        tft.setTextSize(2);
-        tft.setTextColor(status[i] ? COLOR_SUCCESS : COLOR_ERROR);
-        tft.setCursor(390, y + 6);
-        tft.print(status[i] ? "OK" : "ERR");
+        g.fillCircle(50, y + 14, 7, indicatorColor);
+        g.drawCircle(50, y + 14, 8, indicatorColor);
         
-        y += lineHeight;
+        g.setTextSize(2);
+        g.setTextColor(status[i] ? COLOR_SUCCESS : COLOR_ERROR);
+        g.setCursor(390, y + 6);
+        g.print(status[i] ? "OK" : "ERR");
     }
     
-    y += 8;
-    
-    // Panel de información de red
-    tft.fillRoundRect(30, y, 420, 50, 6, COLOR_NAVY);
-    tft.setTextSize(1);
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(45, y + 5);
-    tft.println("NETWORK INFO:");
-    
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(45, y + 20);
+    int y = DIAG_NET_Y;
+    g.setTextSize(1);
+    g.setTextColor(COLOR_TEXT);
+    g.setCursor(45, y + 20);
     if (udpConnected) {
-        tft.printf("IP: %s", WiFi.localIP().toString().c_str());
-        tft.setCursor(45, y + 35);
-        tft.printf("MASTER: %s:%d  RSSI: %ddBm", masterIP, udpPort, WiFi.RSSI());
+        g.printf("IP: %s", WiFi.localIP().toString().c_str());
+        g.setCursor(45, y + 35);
+        g.printf("MASTER: %s:%d  RSSI: %ddBm", masterIP, udpPort, WiFi.RSSI());
     } else {
-        tft.setTextColor(COLOR_ERROR);
-        tft.println("NOT CONNECTED TO MASTER");
-        tft.setCursor(45, y + 35);
-        tft.printf("WiFi: %s", WiFi.status() == WL_CONNECTED ? "OK (no UDP)" : "DISCONNECTED");
+        g.setTextColor(COLOR_ERROR);
+        g.println("NOT CONNECTED TO MASTER");
+        g.setCursor(45, y + 35);
+        g.printf("WiFi: %s", WiFi.status() == WL_CONNECTED ? "OK (no UDP)" : "DISCONNECTED");
     }
-    
-    tft.setTextSize(1);
-    tft.setTextColor(COLOR_TEXT_DIM);
-    tft.setCursor(180, 305);
-    tft.println("BACK: MENU");
 }
 
 void drawHeader() {
-    tft.fillRect(0, 0, 480, 48, COLOR_NAVY);
-    tft.drawFastHLine(0, 48, 480, COLOR_ACCENT);
-    
-    tft.setTextSize(3);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(10, 10);
-    tft.println("R808");
-    
-    // Mostrar nombre de pantalla actual
-    tft.setTextSize(1);
-    tft.setTextColor(COLOR_ACCENT);
-    tft.setCursor(10, 36);
-    if (currentScreen == SCREEN_LIVE) {
-        tft.print("LIVE PADS");
-    } else if (currentScreen == SCREEN_SEQUENCER) {
-        tft.print("SEQUENCER");
-        // Mostrar instrumento activo con su color
-        tft.setTextSize(2);
-        tft.setTextColor(getInstrumentColor(selectedTrack));
-        tft.setCursor(100, 14);
-        String instName = String(instrumentNames[selectedTrack]);
-        instName.trim();
-        tft.print(instName.c_str());
-    } else if (currentScreen == SCREEN_SETTINGS) {
-        tft.print("SETTINGS");
-    } else if (currentScreen == SCREEN_DIAGNOSTICS) {
-        tft.print("DIAGNOSTICS");
-    } else if (currentScreen == SCREEN_PATTERNS) {
-        tft.print("PATTERNS");
+    if (bandRenderEnabled && currentScreen == SCREEN_SEQUENCER) {
+        // Header en bandas: se compone la segunda mientras se envía la primera
+        for (int y = 0; y < 49; y += BAND_HEIGHT) {
+            BandJob job = {};
+            TFT_eSprite& band = bandAcquire(job.buf);
+            drawHeaderTo(band, y);
+            job.y = y;
+            job.h = min(BAND_HEIGHT, 49 - y);
+            job.runCount = 1;
+            job.runX[0] = 0;
+            job.runW[0] = 480;
+            bandSubmit(job);
+        }
+        return;
     }
-    
-    tft.setTextSize(2);
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.setCursor(240, 14);
-    tft.printf("%d", tempo);
-    tft.setTextSize(1);
-    tft.setTextColor(COLOR_TEXT_DIM);
-    tft.setCursor(280, 20);
-    tft.print("BPM");
-    
-    // Mostrar patrón en sequencer
-    if (currentScreen == SCREEN_SEQUENCER) {
-        tft.setTextSize(2);
-        tft.setTextColor(COLOR_TEXT);
-        tft.setCursor(320, 14);
-        tft.printf("P%d", currentPattern + 1);
+    bandWaitIdle();
+    drawHeaderTo(tft, 0);
+}
+
+// Dibujar el header en el TFT o en una banda que empieza en la fila oy
+void drawHeaderTo(TFT_eSPI& g, int oy) {
+    for (int w = 0; w < HDR_WIDGET_COUNT; w++) {
+        drawHeaderWidget(g, w, oy);
+        headerWidgetKey[w] = headerWidgetState(w);
     }
-    
-    // Mostrar ambos volúmenes con indicador de modo activo
-    tft.setTextSize(1);
-    tft.setTextColor(volumeMode == VOL_SEQUENCER ? COLOR_SUCCESS : COLOR_TEXT_DIM);
-    tft.setCursor(370, 12);
-    tft.printf("SEQ:%d%%", sequencerVolume);
-    
-    tft.setTextColor(volumeMode == VOL_LIVE_PADS ? COLOR_SUCCESS : COLOR_TEXT_DIM);
-    tft.setCursor(370, 24);
-    tft.printf("PAD:%d%%", livePadsVolume);
-    
-    // Icono Play/Stop (solo icono, sin texto)
-    if (isPlaying) {
-        tft.fillCircle(455, 24, 10, COLOR_SUCCESS);
-        tft.fillTriangle(450, 18, 450, 30, 460, 24, COLOR_BG);
-    } else {
-        tft.drawCircle(455, 24, 10, COLOR_BORDER);
-        tft.fillRect(451, 19, 3, 10, COLOR_TEXT_DIM);
-        tft.fillRect(456, 19, 3, 10, COLOR_TEXT_DIM);
+    g.drawFastHLine(0, 48 - oy, 480, COLOR_ACCENT);
+    headerWidgetsValid = true;
+}
+
+// Clave del valor que muestra cada widget (cambia = hay que repintarlo)
+uint32_t headerWidgetState(int widget) {
+    switch (widget) {
+        case HDR_TITLE:
+            return currentScreen;
+        case HDR_CONTEXT:
+            return currentScreen | (recordMode << 8) | (selectedTrack << 16);
+        case HDR_TEMPO:
+            return tempo;
+        case HDR_PATTERN:
+            return (currentScreen == SCREEN_SEQUENCER) ? currentPattern + 1 : 0;
+        case HDR_SEQ_VOL:
+            return sequencerVolume | ((volumeMode == VOL_SEQUENCER) << 16);
+        case HDR_PAD_VOL:
+            return livePadsVolume | ((volumeMode == VOL_LIVE_PADS) << 16);
+        case HDR_PLAY:
+            return isPlaying;
+    }
+    return 0;
+}
+
+// Repintar solo los widgets cuyo valor cambió desde el último dibujo
+void updateHeaderWidgets() {
+    if (!headerWidgetsValid) {
+        drawHeader();
+        return;
+    }
+    bool waited = false;
+    for (int w = 0; w < HDR_WIDGET_COUNT; w++) {
+        uint32_t key = headerWidgetState(w);
+        if (key == headerWidgetKey[w]) continue;
+        if (!waited) {
+            bandWaitIdle();  // Zonas pequeñas: directo al TFT
+            waited = true;
+        }
+        drawHeaderWidget(tft, w, 0);
+        headerWidgetKey[w] = key;
+    }
+}
+
+// Fondo de la zona del widget + su contenido
+void drawHeaderWidget(TFT_eSPI& g, int widget, int oy) {
+    const HeaderWidget& hw = HEADER_WIDGETS[widget];
+    g.fillRect(hw.x, hw.y - oy, hw.w, hw.h, COLOR_NAVY);
+    
+    switch (widget) {
+        case HDR_TITLE:
+            g.setTextSize(3);
+            g.setTextColor(COLOR_TEXT);
+            g.setCursor(10, 10 - oy);
+            g.print("R808");
+            
+            // Mostrar nombre de pantalla actual
+            g.setTextSize(1);
+            g.setTextColor(COLOR_ACCENT);
+            g.setCursor(10, 36 - oy);
+            if (currentScreen == SCREEN_LIVE) {
+                g.print("LIVE PADS");
+            } else if (currentScreen == SCREEN_SEQUENCER) {
+                g.print("SEQUENCER");
+            } else if (currentScreen == SCREEN_SETTINGS) {
+                g.print("SETTINGS");
+            } else if (currentScreen == SCREEN_DIAGNOSTICS) {
+                g.print("DIAGNOSTICS");
+            } else if (currentScreen == SCREEN_PATTERNS) {
+                g.print("PATTERNS");
+            }
+            break;
+            
+        case HDR_CONTEXT:
+            if (currentScreen == SCREEN_LIVE && recordMode) {
+                // Indicador de grabación
+                g.fillCircle(110, 22 - oy, 6, COLOR_ERROR);
+                g.setTextSize(2);
+                g.setTextColor(COLOR_ERROR);
+                g.setCursor(122, 15 - oy);
+                g.print("REC");
+            } else if (currentScreen == SCREEN_SEQUENCER) {
+                // Mostrar instrumento activo con su color
+                g.setTextSize(2);
+                g.setTextColor(getInstrumentColor(selectedTrack));
+                g.setCursor(100, 14 - oy);
+                String instName = String(instrumentNames[selectedTrack]);
+                instName.trim();
+                g.print(instName.c_str());
+            }
+            break;
+            
+        case HDR_TEMPO:
+            g.setTextSize(2);
+            g.setTextColor(COLOR_ACCENT2);
+            g.setCursor(240, 14 - oy);
+            g.printf("%d", tempo);
+            g.setTextSize(1);
+            g.setTextColor(COLOR_TEXT_DIM);
+            g.setCursor(280, 20 - oy);
+            g.print("BPM");
+            break;
+            
+        case HDR_PATTERN:
+            // Mostrar patrón en sequencer
+            if (currentScreen == SCREEN_SEQUENCER) {
+                g.setTextSize(2);
+                g.setTextColor(COLOR_TEXT);
+                g.setCursor(320, 14 - oy);
+                g.printf("P%d", currentPattern + 1);
+            }
+            break;
+            
+        case HDR_SEQ_VOL:
+            // Ambos volúmenes con indicador de modo activo
+            g.setTextSize(1);
+            g.setTextColor(volumeMode == VOL_SEQUENCER ? COLOR_SUCCESS : COLOR_TEXT_DIM);
+            g.setCursor(370, 12 - oy);
+            g.printf("SEQ:%d%%", sequencerVolume);
+            break;
+            
+        case HDR_PAD_VOL:
+            g.setTextSize(1);
+            g.setTextColor(volumeMode == VOL_LIVE_PADS ? COLOR_SUCCESS : COLOR_TEXT_DIM);
+            g.setCursor(370, 24 - oy);
+            g.printf("PAD:%d%%", livePadsVolume);
+            break;
+            
+        case HDR_PLAY:
+            // Icono Play/Stop (solo icono, sin texto)
+            if (isPlaying) {
+                g.fillCircle(455, 24 - oy, 10, COLOR_SUCCESS);
+                g.fillTriangle(450, 18 - oy, 450, 30 - oy, 460, 24 - oy, COLOR_BG);
+            } else {
+                g.drawCircle(455, 24 - oy, 10, COLOR_BORDER);
+                g.fillRect(451, 19 - oy, 3, 10, COLOR_TEXT_DIM);
+                g.fillRect(456, 19 - oy, 3, 10, COLOR_TEXT_DIM);
+            }
+            break;
     }
 }
 
@@ -3322,6 +6193,8 @@ void drawLivePad(int padIndex, bool highlight) {
     int x = startX + col * (padW + spacingX);
     int y = startY + row * (padH + spacingY);
     
+    bandWaitIdle();  // Una pulsación puede llegar con la pasada de LIVE aún en el bus
+    
     // Color del instrumento
     uint16_t baseColor = getInstrumentColor(padIndex);
     
@@ -3381,81 +6254,70 @@ void drawLivePad(int padIndex, bool highlight) {
 // ============================================
 
 void drawPatternsScreen() {
+    screenClockMs = millis();
     tft.fillScreen(COLOR_BG);
-    drawHeader();
-    
+    drawPatternsScreenTo(tft);
+}
+
+void drawPatternsScreenTo(TFT_eSPI& g) {
+    drawPatternsChrome(g);
+    drawPatternsContent(g);
+}
+
+// Parte fija de PATTERNS: título y footer (menos la cuantización, que cambia)
+void drawPatternsChrome(TFT_eSPI& g) {
     // Título principal
-    tft.fillRoundRect(120, 55, 240, 35, 8, COLOR_PRIMARY);
-    tft.drawRoundRect(120, 55, 240, 35, 8, COLOR_ACCENT);
-    tft.setTextSize(3);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(135, 62);
-    tft.print("PATTERNS");
+    g.fillRoundRect(120, 55, 240, 35, 8, COLOR_PRIMARY);
+    g.drawRoundRect(120, 55, 240, 35, 8, COLOR_ACCENT);
+    g.setTextSize(3);
+    g.setTextColor(COLOR_TEXT);
+    g.setCursor(135, 62);
+    g.print("PATTERNS");
+    
+    // Instrucciones en el footer
+    g.fillRect(0, 295, 480, 25, COLOR_PRIMARY);
+    g.fillRect(0, 295, 480, 2, COLOR_ACCENT);
+    
+    g.setTextSize(1);
+    g.setTextColor(COLOR_TEXT);
+    g.setCursor(10, 305);
+    g.print("ENCODER:Navigate");
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.print(" | ");
+    g.setTextColor(COLOR_ACCENT);
+    g.print("ENTER:Select");
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.print(" | ");
+    g.setTextColor(COLOR_ACCENT2);
+    g.print("BACK:Menu");
+    g.setTextColor(COLOR_TEXT_DIM);
+    g.print(" | ");
+}
+
+// Parte variable de PATTERNS: header, pads y cuantización del cambio de patrón
+void drawPatternsContent(TFT_eSPI& g) {
+    drawHeaderTo(g, 0);
     
     // Grid de patrones (6 patrones en 2 filas de 3)
     const int maxPatterns = 6;
-    const int cols = 3;
-    const int rows = 2;
-    const int padW = 140;
-    const int padH = 80;
-    const int startX = 25;
-    const int startY = 110;
-    const int spacingX = 15;
-    const int spacingY = 15;
     
     for (int i = 0; i < maxPatterns; i++) {
-        int col = i % cols;
-        int row = i / cols;
-        int x = startX + col * (padW + spacingX);
-        int y = startY + row * (padH + spacingY);
-        
-        bool isSelected = (i == currentPattern);
-        
-        // Fondo del botón
-        if (isSelected) {
-            tft.fillRoundRect(x, y, padW, padH, 8, COLOR_ACCENT);
-            tft.drawRoundRect(x, y, padW, padH, 8, COLOR_ACCENT2);
-        } else {
-            tft.fillRoundRect(x, y, padW, padH, 8, COLOR_PRIMARY);
-            tft.drawRoundRect(x, y, padW, padH, 8, COLOR_BORDER);
-        }
-        
-        // Número de patrón (grande)
-        tft.setTextSize(4);
-        tft.setTextColor(isSelected ? COLOR_BG : COLOR_TEXT);
-        tft.setCursor(x + 15, y + 15);
-        tft.printf("%d", i + 1);
-        
-        // Nombre del patrón
-        tft.setTextSize(1);
-        tft.setTextColor(isSelected ? COLOR_BG : COLOR_TEXT_DIM);
-        tft.setCursor(x + 10, y + 60);
-        String patternName = patterns[i].name;
-        if (patternName.length() > 15) {
-            patternName = patternName.substring(0, 15);
-        }
-        tft.print(patternName);
+        drawSinglePatternTo(g, i, i == patternCursor);
     }
     
-    // Instrucciones en el footer
-    tft.fillRect(0, 295, 480, 25, COLOR_PRIMARY);
-    tft.fillRect(0, 295, 480, 2, COLOR_ACCENT);
-    
-    tft.setTextSize(1);
-    tft.setTextColor(COLOR_TEXT);
-    tft.setCursor(10, 305);
-    tft.print("ENCODER:Navigate");
-    tft.setTextColor(COLOR_TEXT_DIM);
-    tft.print(" | ");
-    tft.setTextColor(COLOR_ACCENT);
-    tft.print("ENTER:Select");
-    tft.setTextColor(COLOR_TEXT_DIM);
-    tft.print(" | ");
-    tft.setTextColor(COLOR_ACCENT2);
-    tft.print("BACK:Menu");
+    // Sigue al texto fijo del footer: 10 + 46 caracteres de 6 px
+    g.setTextSize(1);
+    g.setTextColor(COLOR_WARNING);
+    g.setCursor(286, 305);
+    g.printf("S7:Cancel S8:Q=%dBAR", patternSwitchBars);
 }
 
 void drawSinglePattern(int patternIndex, bool isSelected) {
+    bandWaitIdle();
+    drawSinglePatternTo(tft, patternIndex, isSelected);
+}
+
+void drawSinglePatternTo(TFT_eSPI& g, int patternIndex, bool isSelected) {
     // Redibujar un solo patrón sin parpadeo
     if (patternIndex < 0 || patternIndex >= 6) return;
     
@@ -3474,32 +6336,42 @@ void drawSinglePattern(int patternIndex, bool isSelected) {
     
     // Fondo del botón
     if (isSelected) {
-        tft.fillRoundRect(x, y, padW, padH, 8, COLOR_ACCENT);
-        tft.drawRoundRect(x, y, padW, padH, 8, COLOR_ACCENT2);
+        g.fillRoundRect(x, y, padW, padH, 8, COLOR_ACCENT);
+        g.drawRoundRect(x, y, padW, padH, 8, COLOR_ACCENT2);
     } else {
-        tft.fillRoundRect(x, y, padW, padH, 8, COLOR_PRIMARY);
-        tft.drawRoundRect(x, y, padW, padH, 8, COLOR_BORDER);
+        g.fillRoundRect(x, y, padW, padH, 8, COLOR_PRIMARY);
+        g.drawRoundRect(x, y, padW, padH, 8, COLOR_BORDER);
     }
     
     // Número de patrón (grande)
-    tft.setTextSize(4);
-    tft.setTextColor(isSelected ? COLOR_BG : COLOR_TEXT);
-    tft.setCursor(x + 15, y + 15);
-    tft.printf("%d", patternIndex + 1);
+    g.setTextSize(4);
+    g.setTextColor(isSelected ? COLOR_BG : COLOR_TEXT);
+    g.setCursor(x + 15, y + 15);
+    g.printf("%d", patternIndex + 1);
     
     // Nombre del patrón
-    tft.setTextSize(1);
-    tft.setTextColor(isSelected ? COLOR_BG : COLOR_TEXT_DIM);
-    tft.setCursor(x + 10, y + 60);
+    g.setTextSize(1);
+    g.setTextColor(isSelected ? COLOR_BG : COLOR_TEXT_DIM);
+    g.setCursor(x + 10, y + 60);
     String patternName = patterns[patternIndex].name;
     if (patternName.length() > 15) {
         patternName = patternName.substring(0, 15);
     }
-    tft.print(patternName);
+    g.print(patternName);
+    
+    // Estado: patrón sonando o armado para el próximo compás
+    if (patternIndex == pendingPattern || patternIndex == currentPattern) {
+        bool isPending = (patternIndex == pendingPattern);
+        g.setTextSize(2);
+        g.setTextColor(isPending ? COLOR_WARNING : (isSelected ? COLOR_BG : COLOR_SUCCESS));
+        g.setCursor(x + padW - 62, y + 20);
+        g.print(isPending ? "NEXT" : "PLAY");
+    }
 }
 
 void drawSyncingScreen() {
     // Pantalla temporal de sincronización
+    bandWaitIdle();
     tft.fillScreen(COLOR_BG);
     
     // Caja central con mensaje
@@ -3568,8 +6440,45 @@ void changeTempo(int delta) {
 }
 
 void changePattern(int delta) {
-    currentPattern = (currentPattern + delta + MAX_PATTERNS) % MAX_PATTERNS;
-    currentStep = 0;
+    queuePatternChange((currentPattern + delta + MAX_PATTERNS) % MAX_PATTERNS);
+}
+
+// Armar un cambio de patrón. En play se aplica al final del compás
+// (o tras patternSwitchBars compases); parado se aplica al momento.
+void queuePatternChange(int patternIndex) {
+    patternIndex = constrain(patternIndex, 0, MAX_PATTERNS - 1);
+    
+    if (!isPlaying) {
+        applyPatternChange(patternIndex);
+        return;
+    }
+    
+    if (patternIndex == currentPattern) {
+        cancelPendingPattern();
+        return;
+    }
+    
+    pendingPattern = patternIndex;
+    pendingPatternFetched = false;
+    barsUntilSwitch = patternSwitchBars;
+    
+    // Prefetch: pedir los datos ya, para que estén listos al aplicar el cambio
+    requestPatternFromMaster(patternIndex);
+    
+    Serial.printf("► Pattern %d armed (switch in %d bar(s))\n", patternIndex + 1, barsUntilSwitch);
+}
+
+void applyPatternChange(int patternIndex) {
+    bool needsFetch = !(patternIndex == pendingPattern && pendingPatternFetched);
+    
+    currentPattern = patternIndex;
+    rebuildStepTimingTable();  // Microtiming del nuevo patrón
+    pendingPattern = -1;
+    pendingPatternFetched = false;
+    barsUntilSwitch = 0;
+    if (!isPlaying) {
+        currentStep = 0;
+    }
     needsFullRedraw = true;
     
     // Enviar cambio de patrón al MASTER
@@ -3578,11 +6487,22 @@ void changePattern(int delta) {
     doc["index"] = currentPattern;
     sendUDPCommand(doc);
     
-    // Esperar un poco y solicitar el nuevo patrón automáticamente
-    delay(50);
-    requestPatternFromMaster();
+    // Solo pedir el patrón si el prefetch no llegó a tiempo
+    if (needsFetch) {
+        requestPatternFromMaster();
+    }
+    
+    Serial.printf("► Pattern changed to %d%s\n", currentPattern + 1, 
+                  needsFetch ? ", requesting sync..." : " (prefetched)");
+}
+
+void cancelPendingPattern() {
+    if (pendingPattern < 0) return;
     
-    Serial.printf("► Pattern changed to %d, requesting sync...\n", currentPattern + 1);
+    Serial.printf("► Pattern %d change cancelled\n", pendingPattern + 1);
+    pendingPattern = -1;
+    pendingPatternFetched = false;
+    barsUntilSwitch = 0;
 }
 
 void changeKit(int delta) {
@@ -3604,16 +6524,31 @@ void changeTheme(int delta) {
     // Actualizar TM1638 con nombre del tema
     char display[9];
     snprintf(display, 9, "%-8s", activeTheme->name);
-    tm1.displayText(display);
-    tm2.displayText(display);
+    tmDisplayText(0, display);
+    tmDisplayText(1, display);
     
     Serial.printf("► Theme changed to: %s\n", activeTheme->name);
 }
 
 void changeScreen(Screen newScreen) {
+    bandWaitIdle();  // La pantalla nueva dibuja directo: esperar bandas pendientes
+    if (currentScreen == SCREEN_LIVE && newScreen != SCREEN_LIVE) {
+        flushRecordBatch();
+        memset(noteRepeat, 0, sizeof(noteRepeat));
+    }
+    // Descartar pulsaciones muestreadas en la pantalla anterior
+    padEventHead = padEventTail = 0;
+    sampledButtons = input.buttons;
+    if (newScreen == SCREEN_LIVE) {
+        schedAt(TASK_PADS, micros());
+    }
+    
     currentScreen = newScreen;
+    if (newScreen == SCREEN_PATTERNS) {
+        patternCursor = currentPattern;
+    }
     needsFullRedraw = true;
-    lastDisplayChange = millis();
+    deferDisplayCycle();
     setAllLEDs(0x0000);
     
     // Si entramos al sequencer, mostrar LEDs del track seleccionado y solicitar patrón
@@ -3629,8 +6564,10 @@ void changeScreen(Screen newScreen) {
 }
 
 void toggleStep(int track, int step) {
+    uint16_t oldMask = trackStepMask(patterns[currentPattern], track);
     patterns[currentPattern].steps[track][step] = 
         !patterns[currentPattern].steps[track][step];
+    journalEdit(currentPattern, track, oldMask, oldMask ^ (1 << step));
     needsGridUpdate = true;
     
     Serial.printf("► TOGGLE: Track %d, Step %d = %s\n", 
@@ -3647,6 +6584,215 @@ void toggleStep(int track, int step) {
     sendUDPCommand(doc);
 }
 
+uint16_t trackStepMask(const Pattern& pattern, int track) {
+    uint16_t mask = 0;
+    for (int s = 0; s < MAX_STEPS; s++) {
+        if (pattern.steps[track][s]) mask |= (1 << s);
+    }
+    return mask;
+}
+
+void journalEdit(int patternNum, int track, uint16_t oldMask, uint16_t newMask) {
+    if (oldMask == newMask) return;
+    
+    EditRecord& rec = undoJournal[undoHead];
+    rec.pattern = patternNum;
+    rec.track = track;
+    rec.oldMask = oldMask;
+    rec.newMask = newMask;
+    
+    // Sobrescribe el registro más antiguo cuando el diario está lleno
+    undoHead = (undoHead + 1) % UNDO_JOURNAL_SIZE;
+    if (undoCount < UNDO_JOURNAL_SIZE) undoCount++;
+    redoCount = 0;  // Una edición nueva invalida el rehacer
+}
+
+// Aplicar una máscara de steps a un track y enviar solo la diferencia al MASTER
+static void applyJournalMask(int patternNum, int track, uint16_t mask, const char* label) {
+    Pattern& pattern = patterns[patternNum];
+    uint16_t current = trackStepMask(pattern, track);
+    for (int s = 0; s < MAX_STEPS; s++) {
+        pattern.steps[track][s] = (mask >> s) & 1;
+    }
+    
+    JsonDocument doc;
+    doc["cmd"] = "stepDelta";
+    doc["pattern"] = patternNum;
+    doc["track"] = track;
+    doc["set"] = mask & ~current;
+    doc["clear"] = current & ~mask;
+    sendUDPCommand(doc);
+    
+    if (patternNum == currentPattern) {
+        if (track == selectedTrack) updateStepLEDsForTrack(track);
+        needsGridUpdate = true;
+    }
+    
+    char display1[9];
+    snprintf(display1, 9, "%s %2d", label, undoCount);
+    tmDisplayText(0, display1);
+    tmDisplayText(1, instrumentNames[track]);
+    currentDisplayMode = DISPLAY_STEP;
+    armDisplayRevert();
+    
+    Serial.printf("► %s: Pattern %d, Track %d = 0x%04X\n", label, patternNum + 1, track, mask);
+}
+
+void undoEdit() {
+    if (undoCount == 0) {
+        tmDisplayText(0, "NO UNDO ");
+        return;
+    }
+    undoHead = (undoHead + UNDO_JOURNAL_SIZE - 1) % UNDO_JOURNAL_SIZE;
+    undoCount--;
+    redoCount++;
+    const EditRecord& rec = undoJournal[undoHead];
+    applyJournalMask(rec.pattern, rec.track, rec.oldMask, "UNDO ");
+}
+
+void redoEdit() {
+    if (redoCount == 0) {
+        tmDisplayText(0, "NO REDO ");
+        return;
+    }
+    const EditRecord& rec = undoJournal[undoHead];
+    undoHead = (undoHead + 1) % UNDO_JOURNAL_SIZE;
+    undoCount++;
+    redoCount--;
+    applyJournalMask(rec.pattern, rec.track, rec.newMask, "REDO ");
+}
+
+void editStepVelocity(int track, int step, int delta) {
+    Pattern& pattern = patterns[currentPattern];
+    int level = constrain(getStepVelocity(pattern, track, step) + delta, STEP_VEL_MIN, STEP_VEL_MAX);
+    setStepVelocity(pattern, track, step, level);
+    stepHoldEdited |= (1 << step);
+    
+    // Editar la velocity de un step vacío lo activa
+    if (!pattern.steps[track][step]) {
+        toggleStep(track, step);
+        updateStepLEDsForTrack(track);
+    }
+    sendStepVelocityTrack(currentPattern, track);
+    needsGridUpdate = true;
+    
+    // Feedback en TM1638 (vuelve a BPM tras 2 segundos)
+    char display1[9];
+    snprintf(display1, 9, "VEL %2d%s", level, level >= STEP_VEL_ACCENT ? " A" : "  ");
+    tmDisplayText(0, display1);
+    tmDisplayText(1, instrumentNames[track]);
+    currentDisplayMode = DISPLAY_STEP;
+    armDisplayRevert();
+    
+    Serial.printf("► VELOCITY: Track %d, Step %d = %d/15\n", track, step, level);
+}
+
+void changeSwing(int delta) {
+    swingAmount = constrain(swingAmount + delta, SWING_MIN, SWING_MAX);
+    rebuildStepTimingTable();
+    
+    JsonDocument doc;
+    doc["cmd"] = "swing";
+    doc["value"] = swingAmount;
+    sendUDPCommand(doc);
+    
+    char display1[9];
+    snprintf(display1, 9, "SWING%2d%%", swingAmount);
+    tmDisplayText(0, display1);
+    Serial.printf("► Swing: %d%%\n", swingAmount);
+}
+
+// Microtiming de una columna de steps (afecta a todos los tracks del step)
+void editStepMicroTiming(int step, int delta) {
+    Pattern& pattern = patterns[currentPattern];
+    pattern.micro[step] = constrain(pattern.micro[step] + delta, -MICRO_MAX, MICRO_MAX);
+    stepHoldEdited |= (1 << step);
+    rebuildStepTimingTable();
+    
+    JsonDocument doc;
+    doc["cmd"] = "microTiming";
+    doc["pattern"] = currentPattern;
+    doc["step"] = step;
+    doc["value"] = pattern.micro[step];
+    sendUDPCommand(doc);
+    
+    char display1[12];
+    snprintf(display1, sizeof(display1), "MIC %+3d ", (int)constrain(pattern.micro[step], -MICRO_MAX, MICRO_MAX));
+    tmDisplayText(0, display1);
+    tmDisplayText(1, "  /96   ");
+    currentDisplayMode = DISPLAY_STEP;
+    armDisplayRevert();
+    
+    Serial.printf("► MICROTIMING: Step %d = %+d/96\n", step + 1, pattern.micro[step]);
+}
+
+void cycleStepCondition(int track, int step) {
+    Pattern& pattern = patterns[currentPattern];
+    
+    int next = 0;
+    for (int i = 0; i < conditionPresetCount; i++) {
+        if (conditionPresets[i].code == pattern.cond[track][step]) {
+            next = (i + 1) % conditionPresetCount;
+            break;
+        }
+    }
+    pattern.cond[track][step] = conditionPresets[next].code;
+    stepHoldEdited |= (1 << step);
+    
+    // Asignar una condición a un step vacío lo activa
+    if (!pattern.steps[track][step]) {
+        toggleStep(track, step);
+        updateStepLEDsForTrack(track);
+    }
+    needsGridUpdate = true;
+    
+    JsonDocument doc;
+    doc["cmd"] = "stepCond";
+    doc["pattern"] = currentPattern;
+    doc["track"] = track;
+    doc["step"] = step;
+    doc["cond"] = pattern.cond[track][step];
+    sendUDPCommand(doc);
+    
+    tmDisplayText(0, conditionLabel(pattern.cond[track][step]));
+    tmDisplayText(1, instrumentNames[track]);
+    currentDisplayMode = DISPLAY_STEP;
+    armDisplayRevert();
+    
+    Serial.printf("► CONDITION: Track %d, Step %d = %s\n", track, step, conditionLabel(pattern.cond[track][step]));
+}
+
+void setFillActive(bool active) {
+    if (fillActive == active) return;
+    fillActive = active;
+    
+    // El MASTER necesita el mismo estado de FILL para resolver las condiciones
+    JsonDocument doc;
+    doc["cmd"] = "fill";
+    doc["value"] = fillActive;
+    sendUDPCommand(doc);
+    
+    tmDisplayText(0, fillActive ? "FILL ON " : "FILL OFF");
+    deferDisplayCycle();
+    if (currentScreen == SCREEN_SEQUENCER) {
+        needsGridUpdate = true;
+    }
+    Serial.printf("► FILL: %s\n", fillActive ? "ON" : "OFF");
+}
+
+// Enviar la capa de velocity de un track al MASTER (16 nibbles en hex)
+void sendStepVelocityTrack(int patternNum, int track) {
+    char hex[MAX_STEPS + 1];
+    encodeVelocityTrack(patterns[patternNum], track, hex);
+    
+    JsonDocument doc;
+    doc["cmd"] = "stepVel";
+    doc["pattern"] = patternNum;
+    doc["track"] = track;
+    doc["vel"] = hex;
+    sendUDPCommand(doc);
+}
+
 // ============================================
 // SERVIDOR WEB ASYNC - DESHABILITADO EN SLAVE
 // ============================================
@@ -0,0 +1,139 @@
+// Generador de include/chrome_rle.h: dibuja el fondo fijo de cada pantalla con cada tema
+// en el framebuffer del host y lo guarda comprimido (RLE) por franjas de BAND_HEIGHT filas.
+// Se compila con CHROME_RLE=0 para que el firmware dibuje el fondo con primitivas.
+//
+//   make chrome         -> reescribe include/chrome_rle.h
+//   make chrome-check   -> falla si include/chrome_rle.h no coincide con el dibujo actual
+#include "../../src/main.cpp"
+
+#include <vector>
+
+#define CHROME_PALETTE_MAX  16
+#define CHROME_RUN_MAX      4096
+
+// Mismo orden que enum ChromeScreen y CHROME_DRAW
+static const char* const SOURCES[] = {"MENU", "SETTINGS", "DIAGNOSTICS", "PATTERNS"};
+static const int SOURCE_COUNT = sizeof(SOURCES) / sizeof(SOURCES[0]);
+static_assert(SOURCE_COUNT == CHROME_COUNT, "un nombre por ChromeScreen");
+
+// Tamaño de una entrada de CHROME_IMAGES en el firmware (32 bits)
+struct ChromeImageRef {
+    uint32_t runs;
+    uint32_t palette;
+    uint32_t stripStart[STRIP_COUNT + 1];
+};
+
+struct EncodedImage {
+    std::vector<uint16_t> runs;        // (longitud - 1) << 4 | índice de paleta
+    std::vector<uint16_t> palette;
+    std::vector<uint32_t> stripStart;  // Índice del primer tramo de cada franja
+};
+
+static bool failed = false;
+
+static int paletteIndex(EncodedImage& image, uint16_t color) {
+    for (size_t i = 0; i < image.palette.size(); i++) {
+        if (image.palette[i] == color) return i;
+    }
+    if (image.palette.size() == CHROME_PALETTE_MAX) {
+        fprintf(stderr, "Más de %d colores en un fondo fijo\n", CHROME_PALETTE_MAX);
+        failed = true;
+        return 0;
+    }
+    image.palette.push_back(color);
+    return image.palette.size() - 1;
+}
+
+// Tramos en orden de barrido; se cortan al final de cada franja para poder
+// descomprimir cualquier franja de forma independiente
+static EncodedImage encode(const uint16_t* fb) {
+    EncodedImage image;
+    for (int strip = 0; strip < STRIP_COUNT; strip++) {
+        image.stripStart.push_back(image.runs.size());
+        int first = strip * BAND_HEIGHT * 480;
+        int last = min(320, (strip + 1) * BAND_HEIGHT) * 480;
+        int p = first;
+        while (p < last) {
+            uint16_t color = fb[p];
+            int len = 1;
+            while (p + len < last && fb[p + len] == color && len < CHROME_RUN_MAX) len++;
+            image.runs.push_back((len - 1) << 4 | paletteIndex(image, color));
+            p += len;
+        }
+    }
+    image.stripStart.push_back(image.runs.size());
+    return image;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "uso: %s <salida.h>\n", argv[0]);
+        return 1;
+    }
+    FILE* f = fopen(argv[1], "w");
+    if (!f) {
+        fprintf(stderr, "No se puede escribir %s\n", argv[1]);
+        return 1;
+    }
+
+    tft.init();
+    tft.setRotation(3);
+
+    fprintf(f, "// Generado por test/host/chrome_gen.cpp (make -C test/host chrome): no editar.\n");
+    fprintf(f, "// Fondo fijo de las pantallas por tema en tramos RLE de 16 bits, agrupados por franjas\n");
+    fprintf(f, "// de CHROME_STRIP_HEIGHT filas. Tramo = (longitud - 1) << 4 | índice en la paleta RGB565.\n");
+    fprintf(f, "#pragma once\n#include <stdint.h>\n\n");
+    fprintf(f, "#define CHROME_STRIP_HEIGHT  %d\n", BAND_HEIGHT);
+    fprintf(f, "#define CHROME_STRIPS        %d\n", STRIP_COUNT);
+    fprintf(f, "#define CHROME_SCREENS       %d\n", SOURCE_COUNT);
+    fprintf(f, "#define CHROME_THEMES        %d\n\n", THEME_COUNT);
+    fprintf(f, "struct ChromeImage {\n");
+    fprintf(f, "    const uint16_t* runs;\n");
+    fprintf(f, "    const uint16_t* palette;\n");
+    fprintf(f, "    uint32_t stripStart[CHROME_STRIPS + 1]; // Primer tramo de cada franja\n");
+    fprintf(f, "};\n");
+
+    size_t totalBytes = 0;
+    std::vector<std::vector<EncodedImage>> images(SOURCE_COUNT);
+    for (int t = 0; t < THEME_COUNT; t++) {
+        changeTheme(t - currentTheme);
+        for (int s = 0; s < SOURCE_COUNT; s++) {
+            tft.fillScreen(COLOR_BG);
+            CHROME_DRAW[s](tft);
+            EncodedImage image = encode(tft.framebuffer());
+
+            fprintf(f, "\nstatic const uint16_t CHROME_%s_%d_PAL[] = {", SOURCES[s], t);
+            for (size_t i = 0; i < image.palette.size(); i++) {
+                fprintf(f, "%s0x%04X", i ? ", " : "", image.palette[i]);
+            }
+            fprintf(f, "};\nstatic const uint16_t CHROME_%s_%d[] = {", SOURCES[s], t);
+            for (size_t i = 0; i < image.runs.size(); i++) {
+                fprintf(f, "%s0x%04X,", (i % 12) == 0 ? "\n    " : " ", image.runs[i]);
+            }
+            fprintf(f, "\n};\n");
+            totalBytes += (image.runs.size() + image.palette.size()) * sizeof(uint16_t) +
+                          sizeof(ChromeImageRef);
+            images[s].push_back(image);
+        }
+    }
+
+    fprintf(f, "\nstatic const ChromeImage CHROME_IMAGES[CHROME_SCREENS][CHROME_THEMES] = {\n");
+    for (int s = 0; s < SOURCE_COUNT; s++) {
+        fprintf(f, "    {\n");
+        for (int t = 0; t < THEME_COUNT; t++) {
+            fprintf(f, "        {CHROME_%s_%d, CHROME_%s_%d_PAL, {", SOURCES[s], t, SOURCES[s], t);
+            const std::vector<uint32_t>& starts = images[s][t].stripStart;
+            for (size_t i = 0; i < starts.size(); i++) {
+                fprintf(f, "%s%u", i ? ", " : "", starts[i]);
+            }
+            fprintf(f, "}},\n");
+        }
+        fprintf(f, "    },\n");
+    }
+    fprintf(f, "};\n\n// Total: %zu bytes en flash\n", totalBytes);
+    fclose(f);
+    if (failed) return 1;
+
+    printf("%s: %d pantallas x %d temas, %zu bytes\n", argv[1], SOURCE_COUNT, THEME_COUNT, totalBytes);
+    return 0;
+}
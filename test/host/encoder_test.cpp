@@ -0,0 +1,171 @@
+// Test del encoder: se generan secuencias de cuadratura sintéticas en los pines CLK/DT,
+// se llama a encoderISR() en cada flanco como haría la interrupción CHANGE y se comprueba
+// lo que sale del anillo (detents, rebotes, desbordamiento y aceleración del tempo).
+//
+//   make run            -> también ejecuta ./encoder_test
+#include "../../src/main.cpp"
+#include "host_test.h"
+
+static uint8_t pinClk = 0;
+static uint8_t pinDt = 0;
+
+// Un flanco en un pin y su interrupción
+static void edge(uint8_t pin, uint8_t value) {
+    hostSetDigital(pin, value);
+    encoderISR();
+}
+
+static void resetEncoder() {
+    pinClk = 0;
+    pinDt = 0;
+    hostSetDigital(ENCODER_CLK, 0);
+    hostSetDigital(ENCODER_DT, 0);
+    encoderState = 0;
+    encoderSubSteps = 0;
+    encoderHead = encoderTail = 0;
+    encoderOverflows = 0;
+    encoderLastDir = 0;
+}
+
+// Medio ciclo de cuadratura = un detent. Derecha: 00 -> 01 -> 11 -> 10 -> 00
+static void detent(int dir) {
+    bool forward = dir > 0;
+    if (pinClk == pinDt) {
+        if (forward) edge(ENCODER_DT, pinDt ^= 1); else edge(ENCODER_CLK, pinClk ^= 1);
+        if (forward) edge(ENCODER_CLK, pinClk ^= 1); else edge(ENCODER_DT, pinDt ^= 1);
+    } else {
+        if (forward) edge(ENCODER_CLK, pinClk ^= 1); else edge(ENCODER_DT, pinDt ^= 1);
+        if (forward) edge(ENCODER_DT, pinDt ^= 1); else edge(ENCODER_CLK, pinClk ^= 1);
+    }
+}
+
+static void turn(int detents, uint32_t intervalUs) {
+    for (int i = 0; i < abs(detents); i++) {
+        hostAdvanceMicros(intervalUs);
+        detent(detents > 0 ? 1 : -1);
+    }
+}
+
+static void testSlowTurns() {
+    resetEncoder();
+    turn(5, 200000);
+    EncoderDelta d = readEncoder();
+    expect(d.detents == 5 && d.accelerated == 5, "5 detents lentos a la derecha, sin aceleración");
+    turn(-3, 200000);
+    d = readEncoder();
+    expect(d.detents == -3 && d.accelerated == -3, "3 detents lentos a la izquierda");
+    d = readEncoder();
+    expect(d.detents == 0, "anillo vacío tras leer");
+}
+
+static void testBounce() {
+    resetEncoder();
+    // Rebote en un pin sin completar el detent: no cuenta
+    for (int i = 0; i < 6; i++) edge(ENCODER_DT, pinDt ^= 1);
+    EncoderDelta d = readEncoder();
+    expect(d.detents == 0, "rebote en un pin no genera detents");
+
+    // Rebote a mitad de un detent: cuenta una vez
+    edge(ENCODER_DT, pinDt ^= 1);
+    edge(ENCODER_DT, pinDt ^= 1);
+    edge(ENCODER_DT, pinDt ^= 1);
+    edge(ENCODER_CLK, pinClk ^= 1);
+    d = readEncoder();
+    expect(d.detents == 1, "rebote a mitad de detent: un solo detent");
+
+    // Flanco repetido (la ISR ve el mismo estado): se ignora
+    encoderISR();
+    encoderISR();
+    turn(1, 200000);
+    d = readEncoder();
+    expect(d.detents == 1, "interrupciones sin cambio de estado se ignoran");
+}
+
+static void testNoLostDetents() {
+    resetEncoder();
+    // Giro rápido leído a ritmo del loop: no se pierde ni se junta ningún detent
+    int total = 0;
+    for (int block = 0; block < 50; block++) {
+        turn(7, 1500);
+        total += readEncoder().detents;
+    }
+    expect(total == 350, "350 detents rápidos, todos contados");
+
+    // Ida y vuelta: vuelve a cero
+    turn(-9, 3000);
+    turn(9, 3000);
+    total += readEncoder().detents;
+    expect(total == 350, "ida y vuelta se compensan");
+}
+
+static void testOverflow() {
+    resetEncoder();
+    turn(ENCODER_RING_SIZE + 10, 1000);
+    EncoderDelta d = readEncoder();
+    expect(d.detents == ENCODER_RING_SIZE - 1, "anillo lleno: se guardan RING_SIZE - 1");
+    expect(encoderOverflows == 11, "los detents descartados se cuentan");
+    turn(2, 200000);
+    d = readEncoder();
+    expect(d.detents == 2, "tras desbordar el anillo sigue funcionando");
+}
+
+static void testAccel() {
+    expect(encoderAccel(ENCODER_ACCEL_SLOW_US) == 1 && encoderAccel(1000000) == 1, "lento: factor 1");
+    expect(encoderAccel(ENCODER_ACCEL_FAST_US) == ENCODER_ACCEL_MAX, "rápido: factor máximo");
+    bool monotonic = true;
+    for (uint32_t us = ENCODER_ACCEL_FAST_US; us < ENCODER_ACCEL_SLOW_US; us += 1000) {
+        if (encoderAccel(us + 1000) > encoderAccel(us)) monotonic = false;
+    }
+    expect(monotonic, "el factor baja al girar más despacio");
+
+    resetEncoder();
+    turn(3, 4000);
+    turn(-1, 4000);
+    EncoderDelta d = readEncoder();
+    expect(d.detents == 2 && d.accelerated == 1 + 2 * ENCODER_ACCEL_MAX - 1,
+           "un cambio de sentido empieza sin aceleración");
+}
+
+// De punta a punta por handleEncoder(): encoder pulsado (hold) y un giro rápido
+static void testTempoFlick() {
+    resetEncoder();
+    tempo = MIN_BPM;
+    unsigned long start = millis();
+    input.time = start;
+    input.controls = INPUT_ENCODER_SW;
+    input.controlsPressed = INPUT_ENCODER_SW;
+    handleEncoder();
+    input.controlsPressed = 0;
+    hostAdvanceMicros(400000);
+
+    // Un giro de ~20 detents en 80 ms, leído en cada pasada del loop
+    for (int i = 0; i < 5; i++) {
+        turn(4, 4000);
+        input.time = millis();
+        handleEncoder();
+    }
+    expect(tempo == MAX_BPM, "un giro rápido lleva el tempo de 40 a 240 BPM");
+
+    // Despacio: un BPM por detent
+    hostAdvanceMicros(200000);
+    turn(-3, 200000);
+    input.time = millis();
+    handleEncoder();
+    expect(tempo == MAX_BPM - 3 * BPM_PER_DETENT, "despacio: ajuste fino de 1 BPM");
+    input.controls = 0;
+    input.controlsReleased = INPUT_ENCODER_SW;
+    handleEncoder();
+    input.controlsReleased = 0;
+}
+
+int main() {
+    tmBusBegin();
+    calculateStepInterval();
+    testSlowTurns();
+    testBounce();
+    testNoLostDetents();
+    testOverflow();
+    testAccel();
+    testTempoFlick();
+    return testResult();
+}
@@ -0,0 +1,93 @@
+// Arduino del host: reloj simulado, pines fijados por el test y Serial silencioso
+#include <Arduino.h>
+#include <WiFi.h>
+#include <soc/gpio_struct.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+
+static unsigned long hostMicros = 0;
+static uint32_t hostCycles = 0;
+static int hostDigital[64];
+static int hostAnalog[64];
+static bool hostPinsReady = false;
+
+static void hostInitPins() {
+    if (hostPinsReady) return;
+    // Entradas con pull-up en reposo (encoder y botones sin pulsar)
+    for (int i = 0; i < 64; i++) {
+        hostDigital[i] = HIGH;
+        hostAnalog[i] = 4095;
+    }
+    hostPinsReady = true;
+}
+
+unsigned long millis() { return hostMicros / 1000; }
+unsigned long micros() { return hostMicros; }
+void delay(unsigned long ms) { hostMicros += ms * 1000; hostCycles += ms * 1000 * HOST_CPU_MHZ; }
+void delayMicroseconds(unsigned int us) { hostMicros += us; hostCycles += us * HOST_CPU_MHZ; }
+void hostAdvanceMicros(unsigned long us) { hostMicros += us; hostCycles += us * HOST_CPU_MHZ; }
+uint32_t hostCycleCount() { return hostCycles; }
+
+// Cada lectura cuesta unos ciclos, como el bucle de espera en el ESP32
+uint32_t EspClass::getCycleCount() {
+    hostCycles += 8;
+    return hostCycles;
+}
+
+int digitalRead(uint8_t pin) {
+    hostInitPins();
+    return pin < 64 ? hostDigital[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    hostInitPins();
+    if (pin < 64) hostDigital[pin] = value;
+}
+
+int analogRead(uint8_t pin) {
+    hostInitPins();
+    return pin < 64 ? hostAnalog[pin] : 0;
+}
+
+// Como en el ESP32: OUTPUT activa la salida del pin en los registros GPIO
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= 40) return;
+    bool bank1 = pin >= 32;
+    uint32_t mask = 1UL << (pin & 31);
+    if (mode == OUTPUT) {
+        hostGpioWrite(bank1 ? HOST_GPIO_ENABLE1_W1TS : HOST_GPIO_ENABLE_W1TS, mask);
+    } else {
+        hostGpioWrite(bank1 ? HOST_GPIO_ENABLE1_W1TC : HOST_GPIO_ENABLE_W1TC, mask);
+    }
+}
+void analogReadResolution(uint8_t bits) {}
+void analogSetAttenuation(int attenuation) {}
+
+void hostSetDigital(uint8_t pin, int value) {
+    hostInitPins();
+    if (pin < 64) hostDigital[pin] = value;
+}
+
+void hostSetAnalog(uint8_t pin, int value) {
+    hostInitPins();
+    if (pin < 64) hostAnalog[pin] = value;
+}
+
+void attachInterrupt(int interrupt, void (*isr)(), int mode) {}
+
+long random(long howbig) {
+    return howbig > 0 ? rand() % howbig : 0;
+}
+
+long random(long howsmall, long howbig) {
+    return howbig > howsmall ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    static int verbose = -1;
+    if (verbose < 0) verbose = getenv("HOST_VERBOSE") != nullptr;
+    if (verbose) fputc(c, stderr);
+    return 1;
+}
@@ -0,0 +1,17 @@
+// Utilidades comunes de los tests del host: contador de fallos, una línea por
+// comprobación y el resumen final que devuelve main()
+#pragma once
+
+#include <stdio.h>
+
+static int failures = 0;
+
+static void expect(bool ok, const char* what) {
+    printf("  %s  %s\n", ok ? "ok  " : "FAIL", what);
+    if (!ok) failures++;
+}
+
+static int testResult() {
+    printf("%d fallos\n", failures);
+    return failures ? 1 : 0;
+}
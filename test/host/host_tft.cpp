@@ -0,0 +1,549 @@
+// Framebuffer del host para TFT_eSPI (ver stubs/TFT_eSPI.h)
+#include <TFT_eSPI.h>
+
+// Fuente 1 de TFT_eSPI (Fonts/glcdfont.c, la "Classic" de Adafruit_GFX), ASCII 0x20-0x7E:
+// 5 columnas por carácter, bit 0 = fila superior, bit 7 = descendente
+static const uint8_t glcdFont[95][5] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00},
+    {0x14, 0x7F, 0x14, 0x7F, 0x14}, {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},
+    {0x36, 0x49, 0x56, 0x20, 0x50}, {0x00, 0x08, 0x07, 0x03, 0x00}, {0x00, 0x1C, 0x22, 0x41, 0x00},
+    {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x2A, 0x1C, 0x7F, 0x1C, 0x2A}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+    {0x00, 0x80, 0x70, 0x30, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x00, 0x60, 0x60, 0x00},
+    {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},
+    {0x72, 0x49, 0x49, 0x49, 0x46}, {0x21, 0x41, 0x49, 0x4D, 0x33}, {0x18, 0x14, 0x12, 0x7F, 0x10},
+    {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x31}, {0x41, 0x21, 0x11, 0x09, 0x07},
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x46, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x00, 0x14, 0x00, 0x00},
+    {0x00, 0x40, 0x34, 0x00, 0x00}, {0x00, 0x08, 0x14, 0x22, 0x41}, {0x14, 0x14, 0x14, 0x14, 0x14},
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x59, 0x09, 0x06}, {0x3E, 0x41, 0x5D, 0x59, 0x4E},
+    {0x7C, 0x12, 0x11, 0x12, 0x7C}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+    {0x7F, 0x41, 0x41, 0x41, 0x3E}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01},
+    {0x3E, 0x41, 0x41, 0x51, 0x73}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40},
+    {0x7F, 0x02, 0x1C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46},
+    {0x26, 0x49, 0x49, 0x49, 0x32}, {0x03, 0x01, 0x7F, 0x01, 0x03}, {0x3F, 0x40, 0x40, 0x40, 0x3F},
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, {0x63, 0x14, 0x08, 0x14, 0x63},
+    {0x03, 0x04, 0x78, 0x04, 0x03}, {0x61, 0x59, 0x49, 0x4D, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x41},
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x41, 0x7F}, {0x04, 0x02, 0x01, 0x02, 0x04},
+    {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x03, 0x07, 0x08, 0x00}, {0x20, 0x54, 0x54, 0x78, 0x40},
+    {0x7F, 0x28, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x28}, {0x38, 0x44, 0x44, 0x28, 0x7F},
+    {0x38, 0x54, 0x54, 0x54, 0x18}, {0x00, 0x08, 0x7E, 0x09, 0x02}, {0x18, 0xA4, 0xA4, 0x9C, 0x78},
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x40, 0x3D, 0x00},
+    {0x7F, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x78, 0x04, 0x78},
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0xFC, 0x18, 0x24, 0x24, 0x18},
+    {0x18, 0x24, 0x24, 0x18, 0xFC}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x24},
+    {0x04, 0x04, 0x3F, 0x44, 0x24}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C},
+    {0x3C, 0x40, 0x30, 0x40, 0x3C}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x4C, 0x90, 0x90, 0x90, 0x7C},
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x77, 0x00, 0x00},
+    {0x00, 0x41, 0x36, 0x08, 0x00}, {0x02, 0x01, 0x02, 0x04, 0x02},
+};
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) {
+    if (w > 0 && h > 0) allocate(w, h);
+}
+
+TFT_eSPI::~TFT_eSPI() {
+    delete[] _buffer;
+}
+
+void TFT_eSPI::allocate(int16_t w, int16_t h) {
+    delete[] _buffer;
+    _buffer = new uint16_t[(size_t)w * h]();
+    _width = w;
+    _height = h;
+    resetViewport();
+}
+
+void TFT_eSPI::init() {
+    _stats = {0, 0};
+}
+
+// El buffer no se rota: solo se intercambian las dimensiones lógicas
+void TFT_eSPI::setRotation(uint8_t r) {
+    int16_t longSide = max(_width, _height);
+    int16_t shortSide = min(_width, _height);
+    if (r & 1) {
+        _width = longSide;
+        _height = shortSide;
+    } else {
+        _width = shortSide;
+        _height = longSide;
+    }
+    resetViewport();
+}
+
+// Mismo comportamiento que TFT_eSPI: el datum no se recorta, el área visible sí
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+    _xDatum = vpDatum ? x : 0;
+    _yDatum = vpDatum ? y : 0;
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if (w < 1 || h < 1) {
+        _xDatum = _yDatum = 0;
+        _vpX = _vpY = _vpW = _vpH = 0;  // Fuera de pantalla: no se dibuja nada
+        return;
+    }
+    _vpX = x;
+    _vpY = y;
+    _vpW = x + w;
+    _vpH = y + h;
+}
+
+void TFT_eSPI::resetViewport() {
+    _xDatum = _yDatum = 0;
+    _vpX = _vpY = 0;
+    _vpW = _width;
+    _vpH = _height;
+}
+
+// ---------- Primitivas internas (no cuentan llamadas) ----------
+void TFT_eSPI::rawPixel(int32_t x, int32_t y, uint16_t color) {
+    x += _xDatum;
+    y += _yDatum;
+    if (!_buffer || x < _vpX || y < _vpY || x >= _vpW || y >= _vpH) return;
+    _buffer[y * _width + x] = color;
+    _stats.pixels++;
+}
+
+void TFT_eSPI::rawHLine(int32_t x, int32_t y, int32_t w, uint16_t color) {
+    rawFillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::rawVLine(int32_t x, int32_t y, int32_t h, uint16_t color) {
+    rawFillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::rawFillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (!_buffer) return;
+    x += _xDatum;
+    y += _yDatum;
+    if (x < _vpX) { w -= _vpX - x; x = _vpX; }
+    if (y < _vpY) { h -= _vpY - y; y = _vpY; }
+    if (x + w > _vpW) w = _vpW - x;
+    if (y + h > _vpH) h = _vpH - y;
+    if (w <= 0 || h <= 0) return;
+    for (int32_t row = y; row < y + h; row++) {
+        uint16_t* p = _buffer + row * _width + x;
+        for (int32_t i = 0; i < w; i++) p[i] = color;
+    }
+    _stats.pixels += (uint32_t)w * h;
+}
+
+// Esquinas de drawRoundRect: drawCircleHelper() de TFT_eSPI 2.5.x (tramos en vez de píxeles sueltos)
+void TFT_eSPI::rawCircleHelper(int32_t x0, int32_t y0, int32_t rr, uint8_t corners, uint16_t color) {
+    if (rr <= 0) return;
+    int32_t f = 1 - rr;
+    int32_t ddF_x = 1;
+    int32_t ddF_y = -2 * rr;
+    int32_t xe = 0;
+    int32_t xs = 0;
+    int32_t len = 0;
+    while (xe < rr--) {
+        while (f < 0) {
+            ++xe;
+            f += (ddF_x += 2);
+        }
+        f += (ddF_y += 2);
+
+        if (xe - xs == 1) {
+            if (corners & 0x1) { rawPixel(x0 - xe, y0 - rr, color); rawPixel(x0 - rr, y0 - xe, color); }
+            if (corners & 0x2) { rawPixel(x0 + rr, y0 - xe, color); rawPixel(x0 + xs + 1, y0 - rr, color); }
+            if (corners & 0x4) { rawPixel(x0 + xs + 1, y0 + rr, color); rawPixel(x0 + rr, y0 + xs + 1, color); }
+            if (corners & 0x8) { rawPixel(x0 - rr, y0 + xs + 1, color); rawPixel(x0 - xe, y0 + rr, color); }
+        } else {
+            len = xe - xs++;
+            if (corners & 0x1) { rawHLine(x0 - xe, y0 - rr, len, color); rawVLine(x0 - rr, y0 - xe, len, color); }
+            if (corners & 0x2) { rawVLine(x0 + rr, y0 - xe, len, color); rawHLine(x0 + xs, y0 - rr, len, color); }
+            if (corners & 0x4) { rawHLine(x0 + xs, y0 + rr, len, color); rawVLine(x0 + rr, y0 + xs, len, color); }
+            if (corners & 0x8) { rawVLine(x0 - rr, y0 + xs, len, color); rawHLine(x0 - xe, y0 + rr, len, color); }
+        }
+        xs = xe;
+    }
+}
+
+// Mitades de fillRoundRect: fillCircleHelper() de TFT_eSPI 2.5.x, con líneas horizontales
+// (0x1 = mitad inferior, 0x2 = superior)
+void TFT_eSPI::rawFillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, int32_t delta, uint16_t color) {
+    int32_t f = 1 - r;
+    int32_t ddF_x = 1;
+    int32_t ddF_y = -r - r;
+    int32_t y = 0;
+
+    delta++;
+
+    while (y < r) {
+        if (f >= 0) {
+            if (corners & 0x1) rawHLine(x0 - y, y0 + r, y + y + delta, color);
+            if (corners & 0x2) rawHLine(x0 - y, y0 - r, y + y + delta, color);
+            r--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+
+        y++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (corners & 0x1) rawHLine(x0 - r, y0 + y, r + r + delta, color);
+        if (corners & 0x2) rawHLine(x0 - r, y0 - y, r + r + delta, color);
+    }
+}
+
+// drawChar() de TFT_eSprite para la fuente 1: glifo de 5x8 más una columna de separación,
+// con fondo solo si setTextColor recibió uno; los códigos fuera de la tabla no pintan nada
+void TFT_eSPI::rawChar(int32_t x, int32_t y, uint8_t c) {
+    if (c < 0x20 || c > 0x7E) return;
+    const uint8_t* glyph = glcdFont[c - 0x20];
+    int32_t s = _textSize;
+    for (int32_t col = 0; col < 6; col++) {
+        uint8_t bits = (col < 5) ? glyph[col] : 0;
+        for (int32_t row = 0; row < 8; row++) {
+            if (bits & (1 << row)) {
+                rawFillRect(x + col * s, y + row * s, s, s, _textColor);
+            } else if (_textBgFill) {
+                rawFillRect(x + col * s, y + row * s, s, s, _textBg);
+            }
+        }
+    }
+}
+
+// ---------- API pública ----------
+void TFT_eSPI::fillScreen(uint32_t color) {
+    _stats.calls++;
+    rawFillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    _stats.calls++;
+    rawPixel(x, y, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    _stats.calls++;
+    rawHLine(x, y, w, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    _stats.calls++;
+    rawVLine(x, y, h, color);
+}
+
+// Bresenham de TFT_eSPI: error inicial dx / 2, tramos por el eje mayor
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+    _stats.calls++;
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int32_t dx = x1 - x0, dy = abs(y1 - y0);
+    int32_t err = dx >> 1, ystep = (y0 < y1) ? 1 : -1, xs = x0, dlen = 0;
+    for (; x0 <= x1; x0++) {
+        dlen++;
+        err -= dy;
+        if (err < 0) {
+            if (steep) rawVLine(y0, xs, dlen, color);
+            else rawHLine(xs, y0, dlen, color);
+            dlen = 0;
+            y0 += ystep;
+            xs = x0 + 1;
+            err += dx;
+        }
+    }
+    if (dlen) {
+        if (steep) rawVLine(y0, xs, dlen, color);
+        else rawHLine(xs, y0, dlen, color);
+    }
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    _stats.calls++;
+    rawFillRect(x, y, w, h, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    _stats.calls++;
+    rawHLine(x, y, w, color);
+    rawHLine(x, y + h - 1, w, color);
+    rawVLine(x, y + 1, h - 2, color);
+    rawVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    _stats.calls++;
+    rawFillRect(x, y + r, w, h - r - r, color);
+    rawFillCircleHelper(x + r, y + h - r - 1, r, 1, w - r - r - 1, color);
+    rawFillCircleHelper(x + r, y + r, r, 2, w - r - r - 1, color);
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    _stats.calls++;
+    rawHLine(x + r, y, w - r - r, color);
+    rawHLine(x + r, y + h - 1, w - r - r, color);
+    rawVLine(x, y + r, h - r - r, color);
+    rawVLine(x + w - 1, y + r, h - r - r, color);
+    rawCircleHelper(x + r, y + r, r, 1, color);
+    rawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+    rawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+    rawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+// Punto medio de TFT_eSPI con líneas horizontales
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+    _stats.calls++;
+    int32_t x = 0;
+    int32_t dx = 1;
+    int32_t dy = r + r;
+    int32_t p = -(r >> 1);
+
+    rawHLine(x0 - r, y0, dy + 1, color);
+
+    while (x < r) {
+        if (p >= 0) {
+            rawHLine(x0 - x, y0 + r, dx, color);
+            rawHLine(x0 - x, y0 - r, dx, color);
+            dy -= 2;
+            p -= dy;
+            r--;
+        }
+
+        dx += 2;
+        p += dx;
+        x++;
+
+        rawHLine(x0 - r, y0 + x, dy + 1, color);
+        rawHLine(x0 - r, y0 - x, dy + 1, color);
+    }
+}
+
+// Punto medio de TFT_eSPI: el primer tramo cruza el eje, los demás se reflejan en los 8 octantes
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+    _stats.calls++;
+    if (r <= 0) return;
+    int32_t f = 1 - r;
+    int32_t ddF_y = -2 * r;
+    int32_t ddF_x = 1;
+    int32_t xs = -1;
+    int32_t xe = 0;
+    int32_t len = 0;
+
+    bool first = true;
+    do {
+        while (f < 0) {
+            ++xe;
+            f += (ddF_x += 2);
+        }
+        f += (ddF_y += 2);
+
+        if (xe - xs > 1) {
+            if (first) {
+                len = 2 * (xe - xs) - 1;
+                rawHLine(x0 - xe, y0 + r, len, color);
+                rawHLine(x0 - xe, y0 - r, len, color);
+                rawVLine(x0 + r, y0 - xe, len, color);
+                rawVLine(x0 - r, y0 - xe, len, color);
+                first = false;
+            } else {
+                len = xe - xs++;
+                rawHLine(x0 - xe, y0 + r, len, color);
+                rawHLine(x0 - xe, y0 - r, len, color);
+                rawHLine(x0 + xs, y0 - r, len, color);
+                rawHLine(x0 + xs, y0 + r, len, color);
+
+                rawVLine(x0 + r, y0 + xs, len, color);
+                rawVLine(x0 + r, y0 - xe, len, color);
+                rawVLine(x0 - r, y0 - xe, len, color);
+                rawVLine(x0 - r, y0 + xs, len, color);
+            }
+        } else {
+            ++xs;
+            rawPixel(x0 - xe, y0 + r, color);
+            rawPixel(x0 - xe, y0 - r, color);
+            rawPixel(x0 + xs, y0 - r, color);
+            rawPixel(x0 + xs, y0 + r, color);
+
+            rawPixel(x0 + r, y0 + xs, color);
+            rawPixel(x0 + r, y0 - xe, color);
+            rawPixel(x0 - r, y0 - xe, color);
+            rawPixel(x0 - r, y0 + xs, color);
+        }
+        xs = xe;
+    } while (xe < --r);
+}
+
+// Relleno por líneas horizontales en aritmética entera, como TFT_eSPI: la fila y1 va con
+// el tramo inferior salvo si la base es plana
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+    _stats.calls++;
+    int32_t a, b, y, last;
+    if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+    if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+    if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+    if (y0 == y2) {
+        a = b = x0;
+        if (x1 < a) a = x1;
+        else if (x1 > b) b = x1;
+        if (x2 < a) a = x2;
+        else if (x2 > b) b = x2;
+        rawHLine(a, y0, b - a + 1, color);
+        return;
+    }
+
+    int32_t dx01 = x1 - x0, dy01 = y1 - y0;
+    int32_t dx02 = x2 - x0, dy02 = y2 - y0;
+    int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+
+    last = (y1 == y2) ? y1 : y1 - 1;
+    for (y = y0; y <= last; y++) {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if (a > b) std::swap(a, b);
+        rawHLine(a, y, b - a + 1, color);
+    }
+
+    sa = dx12 * (y - y1);
+    sb = dx02 * (y - y0);
+    for (; y <= y2; y++) {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if (a > b) std::swap(a, b);
+        rawHLine(a, y, b - a + 1, color);
+    }
+}
+
+// Igual que TFT_eSPI: con swapBytes=false los datos vienen en orden de bytes del bus
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    _stats.calls++;
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            uint16_t c = data[row * w + col];
+            if (!_swapBytes) c = (c >> 8) | (c << 8);
+            rawPixel(x + col, y + row, c);
+        }
+    }
+}
+
+// Ventana para los bytes crudos de getSPIinstance().writeBytes (cuenta como una llamada)
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+    _stats.calls++;
+    _winX = x;
+    _winY = y;
+    _winW = w;
+    _winH = h;
+    _winPos = 0;
+    _spi._tft = this;
+    _spi._pendingCount = 0;
+}
+
+void TFT_eSPI::windowPixel(uint16_t color) {
+    if (_winW <= 0 || _winPos >= _winW * _winH) return;
+    rawPixel(_winX + _winPos % _winW, _winY + _winPos / _winW, color);
+    _winPos++;
+}
+
+void SPIClass::writeBytes(const uint8_t* data, uint32_t size) {
+    for (uint32_t i = 0; i < size; i++) {
+        _pending[_pendingCount++] = data[i];
+        if (_pendingCount == 3) {
+            _pendingCount = 0;
+            if (_tft) {
+                _tft->windowPixel(((_pending[0] & 0xF8) << 8) | ((_pending[1] & 0xFC) << 3) | (_pending[2] >> 3));
+            }
+        }
+    }
+}
+
+// Como TFT_eSprite::readPixel: coordenadas relativas al datum del viewport, 0xFFFF fuera de él
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) const {
+    x += _xDatum;
+    y += _yDatum;
+    if (!_buffer || x < _vpX || y < _vpY || x >= _vpW || y >= _vpH) return 0xFFFF;
+    return _buffer[y * _width + x];
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+    if (c == '\n') {
+        _cursorX = 0;
+        _cursorY += 8 * _textSize;
+        return 1;
+    }
+    if (c == '\r') return 1;
+    if (c >= 0x80 && c < 0xC0) return 1;  // Continuación UTF-8: un solo glifo por carácter
+    if (_cursorX + 6 * _textSize > _width) {
+        _cursorX = 0;
+        _cursorY += 8 * _textSize;
+    }
+    _stats.calls++;
+    rawChar(_cursorX, _cursorY, c);
+    _cursorX += 6 * _textSize;
+    return 1;
+}
+
+uint64_t TFT_eSPI::hash() const {
+    uint64_t h = 1469598103934665603ULL;
+    const uint8_t* p = (const uint8_t*)_buffer;
+    for (size_t i = 0; i < (size_t)_width * _height * 2; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+bool TFT_eSPI::writePPM(const char* path) const {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", _width, _height);
+    for (int32_t i = 0; i < (int32_t)_width * _height; i++) {
+        uint16_t c = _buffer[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return true;
+}
+
+// ---------- Sprites ----------
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+    allocate(w, h);
+    return _buffer;
+}
+
+void TFT_eSprite::deleteSprite() {
+    delete[] _buffer;
+    _buffer = nullptr;
+    _width = _height = 0;
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+    pushSprite(x, y, 0, 0, _width, _height);
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+    if (!_buffer || !_parent) return false;
+    _parent->_stats.calls++;
+    for (int32_t row = 0; row < sh; row++) {
+        for (int32_t col = 0; col < sw; col++) {
+            int32_t px = sx + col;
+            int32_t py = sy + row;
+            if (px < 0 || py < 0 || px >= _width || py >= _height) continue;
+            _parent->rawPixel(tx + col, ty + row, _buffer[py * _width + px]);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,212 @@
+// Registros GPIO del host y dos TM1638 simulados bit a bit (ver host_tm1638.h)
+#include <Arduino.h>
+#include <soc/gpio_struct.h>
+#include "host_tm1638.h"
+
+#define SIM_CLK              25
+#define SIM_MIN_PULSE        (HOST_CPU_MHZ * 400 / 1000)  // CLK alto/bajo >= 400 ns
+#define SIM_MIN_STB_HIGH     (HOST_CPU_MHZ * 1)           // STB alto >= 1 µs
+#define SIM_WAIT_READ        (HOST_CPU_MHZ * 1)           // Twait >= 1 µs tras 0x42
+
+HostGpioDev GPIO;
+TMSimChip tmSim[2];
+uint32_t tmSimErrors = 0;
+
+static const int SIM_STB[2] = {33, 32};
+static const int SIM_DIO[2] = {26, 27};
+
+static uint32_t gpioOut[2] = {0, 0};
+static uint32_t gpioEnable[2] = {0, 0};
+static uint32_t lastClkEdge = 0;
+
+struct SimState {
+    bool selected;
+    bool stbSeen;          // Hubo al menos una subida de STB
+    uint32_t stbRise;
+    int bits;              // Bits del byte en curso
+    uint8_t shift;
+    int bytes;             // Bytes completos en la transacción
+    bool autoInc;          // Modo del último comando de datos
+    bool haveAddr;
+    uint8_t addr;
+    bool reading;          // Tras 0x42: el chip saca las teclas
+    uint32_t readReady;
+    int readBit;
+    bool driving;
+    int level;
+};
+static SimState sim[2];
+
+static void simError(int chip, const char* what) {
+    if (tmSimErrors < 20) {
+        fprintf(stderr, "  TM1638 #%d: %s (ciclo %u)\n", chip + 1, what, hostCycleCount());
+    }
+    tmSimErrors++;
+}
+
+void tmSimReset() {
+    memset(tmSim, 0, sizeof(tmSim));
+    memset(sim, 0, sizeof(sim));
+    for (SimState& s : sim) s.autoInc = true;
+    tmSimErrors = 0;
+}
+
+static bool outBit(const uint32_t* regs, int pin) {
+    return (regs[pin >> 5] >> (pin & 31)) & 1;
+}
+
+// Nivel del pin: el ESP32 si tiene la salida activa, si no el chip (drenador abierto)
+// o el pull-up
+static int pinLevel(int pin) {
+    if (outBit(gpioEnable, pin)) return outBit(gpioOut, pin);
+    for (int c = 0; c < 2; c++) {
+        if (pin == SIM_DIO[c] && sim[c].driving) return sim[c].level;
+    }
+    return 1;
+}
+
+static void simByte(int c, uint8_t value) {
+    SimState& s = sim[c];
+    TMSimChip& chip = tmSim[c];
+    if (s.bytes++ > 0) {
+        if (!s.haveAddr) {
+            simError(c, "dato sin comando de dirección");
+            return;
+        }
+        chip.ram[s.addr] = value;
+        if (s.autoInc) s.addr = (s.addr + 1) & 0x0F;
+        return;
+    }
+    switch (value & 0xC0) {
+    case 0x40:
+        if ((value & 0x03) == 0x02) {
+            s.reading = true;
+            s.readReady = hostCycleCount() + SIM_WAIT_READ;
+            s.readBit = 0;
+        } else if ((value & 0x03) == 0) {
+            s.autoInc = !(value & 0x04);
+        } else {
+            simError(c, "comando de datos desconocido");
+        }
+        break;
+    case 0x80:
+        chip.control = value;
+        break;
+    case 0xC0:
+        s.haveAddr = true;
+        s.addr = value & 0x0F;
+        break;
+    default:
+        simError(c, "comando desconocido");
+    }
+}
+
+static void simStbFall(int c) {
+    SimState& s = sim[c];
+    if (s.stbSeen && hostCycleCount() - s.stbRise < SIM_MIN_STB_HIGH) {
+        simError(c, "STB alto menos de 1 us");
+    }
+    s.selected = true;
+    s.bits = 0;
+    s.shift = 0;
+    s.bytes = 0;
+    s.haveAddr = false;
+    s.reading = false;
+    s.driving = false;
+}
+
+static void simStbRise(int c) {
+    SimState& s = sim[c];
+    if (s.bits) simError(c, "STB sube a mitad de byte");
+    if (s.reading && s.readBit != 32) simError(c, "lectura de teclas incompleta");
+    s.selected = false;
+    s.stbSeen = true;
+    s.stbRise = hostCycleCount();
+    s.reading = false;
+    s.driving = false;
+    tmSim[c].transactions++;
+}
+
+// El chip saca el siguiente bit de teclas
+static void simClkFall(int c) {
+    SimState& s = sim[c];
+    if (!s.reading) return;
+    if (hostCycleCount() < s.readReady) simError(c, "lectura antes de Twait");
+    if (s.readBit >= 32) {
+        simError(c, "más de 4 bytes de teclas");
+        return;
+    }
+    s.driving = true;
+    s.level = (tmSim[c].keys[s.readBit >> 3] >> (s.readBit & 7)) & 1;
+    s.readBit++;
+}
+
+// El chip lee DIO (si no está sacando teclas)
+static void simClkRise(int c) {
+    SimState& s = sim[c];
+    tmSim[c].clocks++;
+    if (s.reading) return;
+    if (!outBit(gpioEnable, SIM_DIO[c])) simError(c, "DIO sin salida al escribir");
+    s.shift |= pinLevel(SIM_DIO[c]) << s.bits;
+    if (++s.bits == 8) {
+        simByte(c, s.shift);
+        s.bits = 0;
+        s.shift = 0;
+    }
+}
+
+void hostGpioWrite(int reg, uint32_t value) {
+    int oldClk = pinLevel(SIM_CLK);
+    int oldStb[2], oldDio[2];
+    for (int c = 0; c < 2; c++) {
+        oldStb[c] = pinLevel(SIM_STB[c]);
+        oldDio[c] = pinLevel(SIM_DIO[c]);
+    }
+
+    switch (reg) {
+    case HOST_GPIO_OUT_W1TS: gpioOut[0] |= value; break;
+    case HOST_GPIO_OUT_W1TC: gpioOut[0] &= ~value; break;
+    case HOST_GPIO_ENABLE_W1TS: gpioEnable[0] |= value; break;
+    case HOST_GPIO_ENABLE_W1TC: gpioEnable[0] &= ~value; break;
+    case HOST_GPIO_OUT1_W1TS: gpioOut[1] |= value; break;
+    case HOST_GPIO_OUT1_W1TC: gpioOut[1] &= ~value; break;
+    case HOST_GPIO_ENABLE1_W1TS: gpioEnable[1] |= value; break;
+    case HOST_GPIO_ENABLE1_W1TC: gpioEnable[1] &= ~value; break;
+    default: return;  // in / in1 son de solo lectura
+    }
+
+    int clk = pinLevel(SIM_CLK);
+    uint32_t now = hostCycleCount();
+    bool clkEdge = clk != oldClk;
+    if (clkEdge && now - lastClkEdge < SIM_MIN_PULSE) {
+        for (int c = 0; c < 2; c++) {
+            if (sim[c].selected) simError(c, "pulso de CLK de menos de 400 ns");
+        }
+    }
+
+    for (int c = 0; c < 2; c++) {
+        int stb = pinLevel(SIM_STB[c]);
+        if (oldStb[c] && !stb) simStbFall(c);
+        if (!sim[c].selected) continue;
+        if (sim[c].driving && outBit(gpioEnable, SIM_DIO[c])) {
+            simError(c, "DIO con dos salidas a la vez");
+        }
+        if (!clkEdge && clk && pinLevel(SIM_DIO[c]) != oldDio[c] && !sim[c].reading) {
+            simError(c, "DIO cambia con CLK alto");
+        }
+        if (clkEdge && clk) simClkRise(c);
+        if (clkEdge && !clk) simClkFall(c);
+        if (stb) simStbRise(c);
+    }
+    if (clkEdge) lastClkEdge = now;
+}
+
+uint32_t hostGpioRead(int reg) {
+    int bank = (reg == HOST_GPIO_IN1) ? 1 : 0;
+    if (reg != HOST_GPIO_IN && reg != HOST_GPIO_IN1) return 0;
+    uint32_t levels = 0;
+    for (int bit = 0; bit < 32; bit++) {
+        if (pinLevel(bank * 32 + bit)) levels |= 1UL << bit;
+    }
+    return levels;
+}
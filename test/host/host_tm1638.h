@@ -0,0 +1,18 @@
+// Simulación bit a bit de los dos TM1638 del panel sobre los registros GPIO del host
+// (mismo cableado que src/main.cpp: STB 33/32, CLK 25 compartido, DIO 26/27). Cada chip
+// decodifica los comandos a partir de los flancos y comprueba los tiempos del datasheet.
+#pragma once
+#include <stdint.h>
+
+struct TMSimChip {
+    uint8_t ram[16];
+    uint8_t keys[4];         // Lo que devuelve el comando 0x42
+    uint8_t control;         // Último comando de display (0x80-0x8F), 0 = ninguno
+    uint32_t transactions;   // Ventanas de STB bajo
+    uint32_t clocks;         // Flancos de subida con STB bajo
+};
+
+extern TMSimChip tmSim[2];
+extern uint32_t tmSimErrors;  // Violaciones de protocolo o de tiempos (se imprimen)
+
+void tmSimReset();
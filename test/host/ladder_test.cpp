@@ -0,0 +1,132 @@
+// Test de la escalera de botones: se alimentan rampas sintéticas del ADC bloque a bloque
+// (adcFilterBlock + updateLadder, como pollAdcInputs cada ADC_BLOCK_INTERVAL_US) y se
+// comprueban los eventos: sin pulsaciones falsas al cruzar otros niveles, click frente a
+// hold y el antirrebote de LADDER_DEBOUNCE_MS.
+//
+//   make run            -> también ejecuta ./ladder_test
+#include "../../src/main.cpp"
+#include "host_test.h"
+
+static const int LEVEL_PLAY = 540;    // Centro de cada ventana calibrada
+static const int LEVEL_MUTE = 1525;
+static const int LEVEL_BACK = 2350;
+
+// Eventos acumulados desde el último reset y cuándo llegó el primero de cada tipo
+struct LadderEvents {
+    uint8_t pressed;
+    uint8_t released;
+    uint8_t clicked;
+    uint8_t held;
+    unsigned long pressedAt;
+    unsigned long heldAt;
+};
+static LadderEvents events;
+
+static void block(int adc) {
+    hostAdvanceMicros(ADC_BLOCK_INTERVAL_US);
+    AdcChannel& ch = adcInputs[ADC_IN_BUTTONS];
+    adcFilterBlock(ch, adc);
+    updateLadder(ch.value, millis());
+    if (ladder.pressed && !events.pressed) events.pressedAt = millis();
+    if (ladder.held && !events.held) events.heldAt = millis();
+    events.pressed |= ladder.pressed;
+    events.released |= ladder.released;
+    events.clicked |= ladder.clicked;
+    events.held |= ladder.held;
+    ladder.pressed = ladder.released = ladder.clicked = ladder.held = 0;
+}
+
+static void hold(int adc, uint32_t ms) {
+    for (uint32_t t = 0; t < ms * 1000; t += ADC_BLOCK_INTERVAL_US) block(adc);
+}
+
+// Rampa lineal del valor crudo (el filtro añade la suya encima)
+static void ramp(int from, int to, uint32_t ms) {
+    uint32_t blocks = ms * 1000 / ADC_BLOCK_INTERVAL_US;
+    for (uint32_t i = 1; i <= blocks; i++) block(from + (to - from) * (int)i / (int)blocks);
+}
+
+// Reposo largo para que filtro y máquina de estados vuelvan a cero
+static void rest() {
+    hold(0, 200);
+    events = {};
+}
+
+static void testRampThroughLevels() {
+    rest();
+    ramp(0, LEVEL_BACK, 20);
+    hold(LEVEL_BACK, 150);
+    ramp(LEVEL_BACK, 0, 20);
+    hold(0, 100);
+    expect(events.pressed == INPUT_BACK, "rampa hasta BACK cruzando PLAY y MUTE: solo BACK");
+    expect(events.released == INPUT_BACK && events.clicked == INPUT_BACK, "y al soltar, solo su click");
+
+    rest();
+    hold(LEVEL_BACK, 150);
+    hold(0, 100);
+    expect(events.pressed == INPUT_BACK && events.clicked == INPUT_BACK && !events.held,
+           "escalón directo a BACK: tampoco pasa por MUTE");
+}
+
+static void testLongMute() {
+    rest();
+    hold(LEVEL_MUTE, 1500);
+    expect(events.held == INPUT_MUTE, "MUTE mantenido: hold");
+    expect(events.heldAt - events.pressedAt >= MUTE_HOLD_MS &&
+           events.heldAt - events.pressedAt <= MUTE_HOLD_MS + ADC_BLOCK_INTERVAL_US / 1000,
+           "hold a los MUTE_HOLD_MS de la pulsación");
+    hold(0, 100);
+    expect(events.released == INPUT_MUTE && !events.clicked, "al soltar tras el hold no hay click");
+    expect(events.pressed == INPUT_MUTE, "ni otras pulsaciones al bajar por PLAY");
+}
+
+static void testShortPlay() {
+    rest();
+    hold(LEVEL_PLAY, 100);
+    hold(0, 100);
+    expect(events.pressed == INPUT_PLAY_STOP && events.clicked == INPUT_PLAY_STOP, "PLAY corto: click");
+    expect(!events.held, "sin hold antes de PLAY_STOP_HOLD_MS");
+}
+
+static void testDebounce() {
+    rest();
+    hold(LEVEL_PLAY, LADDER_DEBOUNCE_MS / 2);
+    hold(0, 100);
+    expect(!events.pressed && !events.clicked, "pulso más corto que el antirrebote: nada");
+
+    rest();
+    unsigned long start = millis();
+    hold(LEVEL_PLAY, 60);
+    expect(events.pressed == INPUT_PLAY_STOP, "pulsación estable: se acepta");
+    expect(events.pressedAt - start >= LADDER_DEBOUNCE_MS && events.pressedAt - start <= LADDER_DEBOUNCE_MS + 20,
+           "tras LADDER_DEBOUNCE_MS (más el retardo del filtro)");
+    hold(0, 100);
+}
+
+// De punta a punta: el pin real por pollAdcInputs() (analogRead con sobremuestreo)
+static void testPoll() {
+    rest();
+    hostSetAnalog(ANALOG_BUTTONS_PIN, LEVEL_MUTE);
+    for (int i = 0; i < 50; i++) {
+        hostAdvanceMicros(ADC_BLOCK_INTERVAL_US);
+        pollAdcInputs();
+    }
+    expect(ladder.stable == INPUT_MUTE && ladder.pressed == INPUT_MUTE, "pollAdcInputs lee la escalera");
+    hostSetAnalog(ANALOG_BUTTONS_PIN, 0);
+    for (int i = 0; i < 50; i++) {
+        hostAdvanceMicros(ADC_BLOCK_INTERVAL_US);
+        pollAdcInputs();
+    }
+    expect(ladder.stable == 0 && (ladder.clicked & INPUT_MUTE), "y la liberación");
+    ladder.pressed = ladder.released = ladder.clicked = ladder.held = 0;
+}
+
+int main() {
+    hostSetAnalog(ANALOG_BUTTONS_PIN, 0);
+    testRampThroughLevels();
+    testLongMute();
+    testShortPlay();
+    testDebounce();
+    testPoll();
+    return testResult();
+}
@@ -0,0 +1,110 @@
+// Test de las filas del grid en RGB666: el build del host no tiene bandas (USE_BAND_RENDER=0),
+// así que se crean aquí y se compone cada fila por los dos caminos, composeSpriteGridRow()
+// (referencia RGB565) y composeNativeGridRow(). Los bytes de la banda nativa deben ser los
+// que TFT_eSPI enviaría al ILI9488 por cada píxel del sprite, en todos los tramos enviados.
+//
+//   make run            -> también ejecuta ./native_row_test
+#include "../../src/main.cpp"
+#include "host_test.h"
+
+static const int GRID_X = 8;
+static const int GRID_Y = 88;
+static const int LABEL_W = 38;
+
+// Celdas con los estados que dibuja el grid: vacía, activa con borde, acento, muted, condición
+static void makeCells(CellShadow* cells, int seed) {
+    for (int s = 0; s < MAX_STEPS; s++) {
+        CellShadow& cell = cells[s];
+        int kind = (s * 7 + seed) % 5;
+        cell.flags = CELL_FLAG_VALID;
+        cell.border = COLOR_NAVY;
+        cell.color = COLOR_NAVY_LIGHT;
+        if (kind == 1 || kind == 4) {
+            cell.color = velocityColor(getInstrumentColor(seed % 16), 4 + s % 11);
+            cell.border = getInstrumentColor(seed % 16);
+        } else if (kind == 2) {
+            cell.color = velocityColor(getInstrumentColor(seed % 16), STEP_VEL_ACCENT);
+            cell.border = TFT_WHITE;
+        } else if (kind == 3) {
+            cell.color = 0x3186;
+            cell.border = COLOR_ERROR;
+            cell.flags |= CELL_FLAG_MUTED;
+        }
+        if (kind == 4) cell.flags |= CELL_FLAG_COND;
+    }
+}
+
+// Columnas enviadas: cada celda modificada y el hueco entre dos contiguas
+static bool columnSent(int x, uint16_t dirty) {
+    int rel = x - GRID_X - LABEL_W;
+    if (rel < 0) return false;
+    int s = rel / (TILE_W + 1);
+    if (s >= MAX_STEPS || !(dirty & (1 << s))) return false;
+    return rel % (TILE_W + 1) < TILE_W || (s + 1 < MAX_STEPS && (dirty & (1 << (s + 1))));
+}
+
+// Una fila por los dos caminos; devuelve los píxeles que difieren
+static uint32_t compareRow(int row, const CellShadow* cells, uint16_t dirty) {
+    int bandY = GRID_Y + 1 + row * (TILE_H + 2);
+    uint8_t spriteBuf = bandNext;
+    uint32_t spritePixels = composeSpriteGridRow(bandY, row, false, cells, dirty);
+    uint8_t nativeBuf = bandNext;
+    uint32_t nativePixels = composeNativeGridRow(bandY, cells, dirty);
+    uint32_t diffs = (spritePixels != nativePixels) ? 1 : 0;
+
+    const TFT_eSprite& sprite = bandSprite[spriteBuf];
+    const uint8_t* native = nativeBand[nativeBuf];
+    for (int y = 0; y < BAND_HEIGHT; y++) {
+        for (int x = 0; x < 480; x++) {
+            if (!columnSent(x, dirty)) continue;
+            uint8_t expected[NATIVE_BPP];
+            color666(sprite.readPixel(x, y), expected);
+            if (memcmp(native + (y * 480 + x) * NATIVE_BPP, expected, NATIVE_BPP) != 0) {
+                if (!diffs) printf("       fila %d: (%d, %d) distinto\n", row, x, bandY + y);
+                diffs++;
+            }
+        }
+    }
+    return diffs;
+}
+
+static void testRows(const char* what, int playhead) {
+    playheadDrawn = playhead;
+    // Tramos del carril como con trigs que suenan, callados y filas vacías
+    for (int row = 0; row < 8; row++) {
+        playheadRailColor[row] = (row % 3 == 0) ? getInstrumentColor(row)
+                               : (row % 3 == 1) ? COLOR_TEXT_DIM : COLOR_WARNING;
+    }
+    static const uint16_t DIRTY[] = {0xFFFF, 0x0001, 0x8000, 0x0018, 0x0F0F, 0x5AA5, 0x1111};
+    uint32_t diffs = 0;
+    for (int row = 0; row < 8; row++) {
+        CellShadow cells[MAX_STEPS];
+        makeCells(cells, row);
+        for (uint16_t dirty : DIRTY) {
+            diffs += compareRow(row, cells, dirty);
+        }
+    }
+    char line[96];
+    snprintf(line, sizeof(line), "%s: %s", activeTheme->name, what);
+    expect(diffs == 0, line);
+    playheadDrawn = -1;
+}
+
+int main() {
+    tft.init();
+    tft.setRotation(3);
+    setupTileCache();
+    for (int b = 0; b < 2; b++) {
+        bandSprite[b].createSprite(480, BAND_HEIGHT);
+        nativeBand[b] = (uint8_t*)malloc(480 * BAND_HEIGHT * NATIVE_BPP);
+    }
+
+    for (int t = 0; t < THEME_COUNT; t++) {
+        changeTheme(t - currentTheme);
+        testRows("filas RGB666 = bandas RGB565 (sin playhead)", -1);
+        testRows("con los carriles del playhead en el step 0", 0);
+        testRows("con los carriles del playhead en el step 7", 7);
+        testRows("con los carriles del playhead en el step 15", 15);
+    }
+    return testResult();
+}
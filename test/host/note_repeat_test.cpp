@@ -0,0 +1,167 @@
+// Test del note repeat: se mantiene un pad en SCREEN_LIVE, se llama a serviceNoteRepeat()
+// como cada vuelta del loop (una por ms) y se comprueba cuándo salen los "trigger" por UDP:
+// periodo según tempo y velocidad, fase en la rejilla del reloj de steps y rampa de velocity.
+//
+//   make run            -> también ejecuta ./note_repeat_test
+#include "../../src/main.cpp"
+#include "host_test.h"
+
+#include <vector>
+
+static int unsentRepeats = 0;    // Repeticiones sin su paquete UDP
+
+struct Hit {
+    uint32_t time;
+    int pad;
+    int vel;
+};
+
+// Avanzar el reloj 1 ms por vuelta y recoger los triggers enviados (el pad es el que
+// cuenta una repetición más; la velocity, la de esa repetición)
+static std::vector<Hit> runFor(uint32_t ms) {
+    std::vector<Hit> hits;
+    for (uint32_t i = 0; i < ms; i++) {
+        hostAdvanceMicros(1000);
+        uint32_t sent = udp.sent;
+        uint8_t counts[16];
+        for (int p = 0; p < 16; p++) counts[p] = noteRepeat[p].count;
+        serviceNoteRepeat();
+        uint32_t repeats = 0;
+        for (int p = 0; p < 16; p++) {
+            if (noteRepeat[p].count != counts[p]) {
+                hits.push_back({(uint32_t)micros(), p, noteRepeatVelocity(counts[p])});
+                repeats++;
+            }
+        }
+        if (udp.sent - sent != repeats) unsentRepeats++;
+    }
+    return hits;
+}
+
+static void press(int pad) {
+    sampledButtons |= (1 << pad);
+    handleLivePadPress(pad, millis());
+}
+
+static void release(int pad) {
+    sampledButtons &= ~(1 << pad);
+}
+
+static bool intervalsWithin(const std::vector<Hit>& hits, uint32_t periodUs, uint32_t toleranceUs) {
+    for (size_t i = 1; i < hits.size(); i++) {
+        uint32_t interval = hits[i].time - hits[i - 1].time;
+        if (interval + toleranceUs < periodUs || interval > periodUs + toleranceUs) return false;
+    }
+    return true;
+}
+
+static void testStopped() {
+    isPlaying = false;
+    tempo = 120;
+    repeatRate = REPEAT_1_16;
+    repeatRamp = RAMP_OFF;
+    uint32_t sent = udp.sent;
+    press(0);
+    expect(udp.sent - sent == 1, "el golpe sale al pulsar");
+    uint32_t pressUs = micros();
+    std::vector<Hit> hits = runFor(1000);
+    expect(hits.size() == 8, "1/16 a 120 BPM: 8 repeticiones por segundo");
+    expect(!hits.empty() && hits[0].time - pressUs == 125000, "primera repetición un 1/16 después");
+    expect(intervalsWithin(hits, 125000, 1000), "periodo de 125 ms (±1 ms)");
+    release(0);
+    hits = runFor(500);
+    expect(hits.empty(), "soltar el pad para las repeticiones");
+}
+
+static void testRates() {
+    isPlaying = false;
+    tempo = 100;
+    repeatRate = REPEAT_1_8;
+    changeRepeatRate(1);
+    expect(repeatRate == REPEAT_1_16, "el encoder cambia la velocidad");
+    changeRepeatRate(-2);
+    expect(repeatRate == REPEAT_1_32T, "con vuelta al final de la lista");
+    changeRepeatRate(1);
+    expect(repeatRate == REPEAT_1_8, "y al principio");
+
+    static const uint32_t expected[REPEAT_RATE_COUNT] = {300000, 150000, 75000, 200000, 100000, 50000};
+    bool allOk = true;
+    for (int r = 0; r < REPEAT_RATE_COUNT; r++) {
+        repeatRate = r;
+        press(3);
+        std::vector<Hit> hits = runFor(1200);
+        release(3);
+        runFor(10);
+        if (hits.size() < 3 || !intervalsWithin(hits, expected[r], 1000)) {
+            printf("       %s: %zu repeticiones\n", REPEAT_RATES[r].name, hits.size());
+            allOk = false;
+        }
+    }
+    expect(allOk, "1/8, 1/16, 1/32 y tresillos a 100 BPM");
+}
+
+static void testStepClockPhase() {
+    tempo = 120;
+    repeatRate = REPEAT_1_32T;
+    repeatRamp = RAMP_OFF;
+    isPlaying = true;
+    hostAdvanceMicros(7300);
+    lastStepTime = millis() - 40;       // Rejilla del reloj de steps, no la pulsación
+    uint32_t gridUs = lastStepTime * 1000UL;
+    uint32_t periodUs = noteRepeatPeriodUs();
+    press(5);
+    std::vector<Hit> hits = runFor(600);
+    release(5);
+    bool inPhase = !hits.empty();
+    for (const Hit& hit : hits) {
+        if ((hit.time - gridUs) % periodUs >= 1000) inPhase = false;
+    }
+    expect(inPhase, "en play las repeticiones caen en la rejilla de steps");
+    expect(hits.size() >= 13 && hits[0].pad == 5, "tresillos de 1/32 a 120 BPM (41,7 ms)");
+    isPlaying = false;
+}
+
+static void testRamp() {
+    isPlaying = false;
+    tempo = 120;
+    repeatRate = REPEAT_1_32;
+    repeatRamp = RAMP_OFF;
+    cycleRepeatRamp();
+    expect(repeatRamp == RAMP_UP, "click del encoder: rampa hacia arriba");
+    press(1);
+    std::vector<Hit> hits = runFor(1000);
+    release(1);
+    runFor(10);
+    bool rising = hits.size() > 4;
+    for (size_t i = 1; i < hits.size(); i++) {
+        if (hits[i].vel < hits[i - 1].vel) rising = false;
+    }
+    expect(rising && hits.front().vel < hits.back().vel && hits.back().vel == liveVelocity(),
+           "rampa: la velocity sube hasta la del pad");
+
+    cycleRepeatRamp();
+    press(1);
+    hits = runFor(1000);
+    release(1);
+    runFor(10);
+    bool falling = hits.size() > 4;
+    for (size_t i = 1; i < hits.size(); i++) {
+        if (hits[i].vel > hits[i - 1].vel) falling = false;
+    }
+    expect(falling && hits.back().vel == liveVelocity() / 4, "rampa: la velocity baja hasta 1/4");
+    cycleRepeatRamp();
+    expect(repeatRamp == RAMP_OFF, "tercer click: sin rampa");
+}
+
+int main() {
+    tmBusBegin();
+    udpConnected = true;
+    currentScreen = SCREEN_LIVE;
+    hostAdvanceMicros(1000000);
+    testStopped();
+    testRates();
+    testStepClockPhase();
+    testRamp();
+    expect(unsentRepeats == 0, "cada repetición sale como un trigger UDP");
+    return testResult();
+}
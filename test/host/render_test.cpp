@@ -0,0 +1,318 @@
+// Test de render en el host: compila src/main.cpp contra los stubs de test/host/stubs,
+// dibuja cada pantalla con cada tema en el framebuffer y compara el hash con golden.txt.
+// También comprueba el presupuesto de píxeles de las transiciones incrementales y que
+// include/chrome_rle.h pasa la comprobación del firmware contra las primitivas.
+//
+//   make run            -> compara con golden.txt (PPM en out/ si hay diferencias)
+//   make update         -> reescribe golden.txt y vuelca todos los PPM en out/
+#include "../../src/main.cpp"
+#include "host_test.h"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <sys/stat.h>
+
+static const char* GOLDEN_PATH = "golden.txt";
+static const char* OUT_DIR = "out";
+
+struct RenderResult {
+    uint64_t hash;
+    uint32_t pixels;
+    uint32_t calls;
+};
+
+struct PixelBudget {
+    const char* name;
+    uint32_t maxPixels;
+};
+
+// Pantallas completas por franjas: cada píxel se envía una vez (480x320 = 153600)
+// Transiciones incrementales: solo la zona que cambia
+static const PixelBudget BUDGETS[] = {
+    {"menu_", 153600},
+    {"live_", 153600},
+    {"sequencer_", 153600},
+    {"settings_", 153600},
+    {"diagnostics_", 153600},
+    {"patterns_", 153600},
+    {"seq_step_advance", 1200},     // Playhead: capa vieja + nueva (sin celdas)
+    {"seq_step_toggle", 4000},      // Una celda
+    {"seq_header_bpm", 5000},       // Solo el widget de BPM
+    {"seq_header_volume", 2000},    // Solo el widget SEQ:xx%
+};
+
+static std::map<std::string, RenderResult> goldens;
+static std::map<std::string, RenderResult> results;
+static bool updateMode = false;
+
+static const char* SCREEN_NAMES[] = {
+    "boot", "menu", "live", "sequencer", "settings", "diagnostics", "patterns"
+};
+
+static void loadGoldens() {
+    FILE* f = fopen(GOLDEN_PATH, "r");
+    if (!f) return;
+    char name[64];
+    unsigned long long hash;
+    unsigned pixels, calls;
+    while (fscanf(f, "%63s %llx %u %u", name, &hash, &pixels, &calls) == 4) {
+        goldens[name] = {(uint64_t)hash, pixels, calls};
+    }
+    fclose(f);
+}
+
+static void saveGoldens() {
+    FILE* f = fopen(GOLDEN_PATH, "w");
+    if (!f) {
+        fprintf(stderr, "No se puede escribir %s\n", GOLDEN_PATH);
+        failures++;
+        return;
+    }
+    for (const auto& r : results) {
+        fprintf(f, "%s %016llx %u %u\n", r.first.c_str(),
+                (unsigned long long)r.second.hash, r.second.pixels, r.second.calls);
+    }
+    fclose(f);
+}
+
+static void dumpPPM(const std::string& name) {
+    mkdir(OUT_DIR, 0755);
+    std::string path = std::string(OUT_DIR) + "/" + name + ".ppm";
+    tft.writePPM(path.c_str());
+}
+
+// Ejecutar el planificador como lo hace loop() hasta que no quede trabajo
+static void renderUntilIdle() {
+    for (int guard = 0; guard < 1000; guard++) {
+        scheduleRender();
+        if (!renderJob.active) return;
+        runRenderJob();
+        hostAdvanceMicros(16000);
+    }
+    fprintf(stderr, "El trabajo de render no termina\n");
+    failures++;
+}
+
+static void check(const std::string& name) {
+    RenderResult r = {tft.hash(), tft.stats().pixels, tft.stats().calls};
+    results[name] = r;
+
+    bool mismatch = false;
+    auto it = goldens.find(name);
+    if (updateMode) {
+        dumpPPM(name);
+    } else if (it == goldens.end()) {
+        printf("  NEW   %-28s px=%-7u calls=%u\n", name.c_str(), r.pixels, r.calls);
+        mismatch = true;
+    } else if (it->second.hash != r.hash) {
+        printf("  DIFF  %-28s px=%-7u calls=%u\n", name.c_str(), r.pixels, r.calls);
+        mismatch = true;
+    } else {
+        printf("  ok    %-28s px=%-7u calls=%u\n", name.c_str(), r.pixels, r.calls);
+    }
+    if (mismatch) {
+        dumpPPM(name);
+        failures++;
+    }
+
+    for (const PixelBudget& b : BUDGETS) {
+        if (name.find(b.name) == 0 && r.pixels > b.maxPixels) {
+            printf("  OVER  %-28s %u px > %u px\n", name.c_str(), r.pixels, b.maxPixels);
+            failures++;
+        }
+    }
+}
+
+static void renderFull(Screen screen) {
+    currentScreen = screen;
+    needsFullRedraw = true;
+    tft.resetStats();
+    renderUntilIdle();
+}
+
+// Lo que dejó el repintado incremental debe ser igual a repintar la pantalla entera
+static void checkMatchesFull(const std::string& name) {
+    std::vector<uint16_t> incremental(tft.framebuffer(), tft.framebuffer() + 480 * 320);
+    renderFull(currentScreen);
+    uint32_t diffs = 0;
+    for (int i = 0; i < 480 * 320; i++) {
+        if (incremental[i] != tft.framebuffer()[i]) diffs++;
+    }
+    if (diffs) {
+        printf("  FULL  %-28s %u px distintos del repintado completo\n", name.c_str(), diffs);
+        failures++;
+    } else {
+        printf("  ok    %-28s = repintado completo\n", name.c_str());
+    }
+}
+
+// Avanzar el reloj de steps como updateSequencer: step nuevo con sus condiciones evaluadas
+static void advanceStep() {
+    currentStep = (currentStep + 1) % MAX_STEPS;
+    clockPrevStep = currentStep;
+    evaluateStepConditions(currentStep);
+    needsGridUpdate = true;
+}
+
+// Tramo del carril izquierdo del playhead en una fila del grid
+static uint16_t railPixel(int row) {
+    return tft.readPixel(playheadRailX(currentStep, 0), PLAYHEAD_RAIL_Y + row * (TILE_H + 2) + TILE_H / 2);
+}
+
+static void runTheme(int theme) {
+    changeTheme(theme - currentTheme);
+    std::string suffix = std::string("_") + activeTheme->name;
+    for (char& c : suffix) {
+        if (c == ' ') c = '_';
+    }
+
+    for (int s = SCREEN_MENU; s <= SCREEN_PATTERNS; s++) {
+        renderFull((Screen)s);
+        check(std::string(SCREEN_NAMES[s]) + suffix);
+    }
+
+    // Transiciones incrementales del secuenciador sobre un repintado completo (en play).
+    // En el step siguiente: track 1 suena, track 2 tiene un trig condicional que no toca en
+    // el loop 0, track 3 está muteado y track 4 vacío
+    Pattern& pattern = patterns[currentPattern];
+    int next = (currentStep + 1) % MAX_STEPS;
+    for (int t = 0; t < 3; t++) pattern.steps[t][next] = true;
+    pattern.cond[1][next] = COND_EVERY(2, 2);
+    pattern.muted[2] = true;
+    loopCount = 0;
+    isPlaying = true;
+    clockPrevStep = currentStep;
+    evaluateStepConditions(currentStep);
+    renderFull(SCREEN_SEQUENCER);
+
+    advanceStep();
+    tft.resetStats();
+    renderUntilIdle();
+    check("seq_step_advance" + suffix);
+    bool trigRails = railPixel(0) == getInstrumentColor(0) && railPixel(1) == COLOR_TEXT_DIM &&
+                     railPixel(2) == COLOR_TEXT_DIM && railPixel(3) == COLOR_WARNING;
+    printf("  %s  %-28s carril: suena / condición / mute / vacío\n", trigRails ? "ok  " : "FAIL",
+           ("seq_step_trig" + suffix).c_str());
+    if (!trigRails) failures++;
+    checkMatchesFull("seq_step_advance" + suffix);
+
+    // Mute en el mismo step: el tramo de la fila cambia sin mover el playhead
+    pattern.muted[0] = true;
+    evaluateStepConditions(currentStep);
+    needsGridUpdate = true;
+    renderUntilIdle();
+    if (railPixel(0) != COLOR_TEXT_DIM) {
+        printf("  FAIL  %-28s el mute no apaga el tramo\n", ("seq_step_mute" + suffix).c_str());
+        failures++;
+    }
+    checkMatchesFull("seq_step_mute" + suffix);
+    pattern.muted[0] = false;
+    evaluateStepConditions(currentStep);
+    needsGridUpdate = true;
+    renderUntilIdle();
+
+    patterns[currentPattern].steps[0][5] = !patterns[currentPattern].steps[0][5];
+    needsGridUpdate = true;
+    tft.resetStats();
+    renderUntilIdle();
+    check("seq_step_toggle" + suffix);
+    checkMatchesFull("seq_step_toggle" + suffix);
+    patterns[currentPattern].steps[0][5] = !patterns[currentPattern].steps[0][5];
+    needsGridUpdate = true;
+    renderUntilIdle();
+
+    tempo += 1;
+    needsHeaderUpdate = true;
+    tft.resetStats();
+    renderUntilIdle();
+    check("seq_header_bpm" + suffix);
+    tempo -= 1;
+    needsHeaderUpdate = true;
+    renderUntilIdle();
+
+    sequencerVolume -= 5;
+    needsHeaderUpdate = true;
+    tft.resetStats();
+    renderUntilIdle();
+    check("seq_header_volume" + suffix);
+    sequencerVolume += 5;
+    needsHeaderUpdate = true;
+    renderUntilIdle();
+    checkMatchesFull("seq_header" + suffix);
+    for (int t = 0; t < 3; t++) pattern.steps[t][next] = false;
+    pattern.cond[1][next] = COND_ALWAYS;
+    pattern.muted[2] = false;
+    currentStep = 0;
+    clockPrevStep = -1;
+    stepTrigMask = 0;
+    isPlaying = false;
+}
+
+// Cada fondo en flash se comparó franja a franja con el dibujo de las primitivas al usarse
+static void checkChromeImages() {
+    for (int c = 0; c < CHROME_COUNT; c++) {
+        for (int t = 0; t < THEME_COUNT; t++) {
+            const ChromeCheck& check = chromeCheck[c][t];
+            char line[96];
+            snprintf(line, sizeof(line), "chrome %d (%s) = primitivas en las %d franjas", c, THEMES[t]->name, STRIP_COUNT);
+            expect(check.strips == (1 << STRIP_COUNT) - 1 && !check.mismatch, line);
+        }
+    }
+}
+
+// La segunda franja (parte baja de la barra del menú, y = BAND_HEIGHT con viewport): la
+// comparación la valida y la siguiente composición sale de flash, sin fillSprite ni fondo
+// con primitivas (menos píxeles escritos en la banda)
+static void checkChromeStripFromFlash() {
+    const int strip = 1;
+    currentScreen = SCREEN_MENU;
+    chromeCheck[CHROME_MENU][currentTheme] = {};
+    stripSprite.resetStats();
+    composeScreenStrip(strip, drawMainMenuContent, CHROME_MENU);
+    uint32_t checkedPixels = stripSprite.stats().pixels;
+    const ChromeCheck& check = chromeCheck[CHROME_MENU][currentTheme];
+    expect(check.strips == (1 << strip) && !check.mismatch, "franja intermedia validada con el viewport activo");
+
+    stripSprite.resetStats();
+    composeScreenStrip(strip, drawMainMenuContent, CHROME_MENU);
+    expect(stripSprite.stats().pixels < checkedPixels, "y la siguiente vez se descomprime de flash");
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) updateMode = true;
+    }
+    srand(808);
+
+    tft.init();
+    tft.setRotation(3);
+    setupBandRenderer();
+    setupStripRenderer();
+    setupTileCache();
+    setupKits();
+    setupPatterns();
+    calculateStepInterval();
+
+    if (!updateMode) loadGoldens();
+
+    for (int t = 0; t < THEME_COUNT; t++) {
+        runTheme(t);
+    }
+    checkChromeImages();
+    checkChromeStripFromFlash();
+
+    if (updateMode) {
+        saveGoldens();
+        printf("%s actualizado (%zu capturas en %s/)\n", GOLDEN_PATH, results.size(), OUT_DIR);
+    } else {
+        for (const auto& g : goldens) {
+            if (!results.count(g.first)) {
+                printf("  MISS  %s\n", g.first.c_str());
+                failures++;
+            }
+        }
+        printf("%zu capturas, %d fallos\n", results.size(), failures);
+    }
+    return failures ? 1 : 0;
+}
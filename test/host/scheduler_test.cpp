@@ -0,0 +1,177 @@
+// Test del planificador: se ejecuta loop() con el reloj simulado (delay() avanza el
+// tiempo del host) y se comprueba que duerme entre plazos, que cada tarea corre a su
+// periodo, que los plazos únicos (LEDs, texto del TM1638) vencen a tiempo, que el reloj
+// de steps no queda redondeado a 16 ms, que un detent del encoder se atiende al momento y
+// que el antirrebote del botón de volumen no duerme dentro de la tarea.
+//
+//   make run            -> también ejecuta ./scheduler_test
+#include "../../src/main.cpp"
+#include "host_test.h"
+
+static uint32_t passes = 0;
+
+static void runLoopFor(uint32_t ms) {
+    uint32_t start = micros();
+    while (micros() - start <= ms * 1000UL) {
+        loop();
+        passes++;
+    }
+}
+
+// Una vuelta de loop() mirando el estado antes de dormir: devuelve true si done() se cumple
+static bool passUntil(bool (*done)()) {
+    runDueTasks();
+    if (done()) return true;
+    schedSleep();
+    return false;
+}
+
+static uint32_t runs(int task) {
+    return taskState[task].runs;
+}
+
+static void testPeriods() {
+    uint32_t before[TASK_COUNT];
+    for (int i = 0; i < TASK_COUNT; i++) before[i] = runs(i);
+    uint32_t wakes = schedStats.wakes;
+    uint32_t idle = schedStats.idleUs;
+    passes = 0;
+    runLoopFor(2000);
+
+    expect(runs(TASK_INPUT) - before[TASK_INPUT] == 2000 / INPUT_INTERVAL_MS, "entradas cada 5 ms");
+    expect(runs(TASK_FRAME) - before[TASK_FRAME] == 2000 / FRAME_INTERVAL_MS, "frame cada 16 ms");
+    expect(runs(TASK_VIZ) - before[TASK_VIZ] == 2000 / VIZ_INTERVAL_MS, "visualización cada 50 ms");
+    expect(runs(TASK_VOLUME) - before[TASK_VOLUME] == 2000 / VOLUME_INTERVAL_MS, "volumen cada 100 ms");
+    expect(runs(TASK_PADS) == before[TASK_PADS], "pads sin muestrear fuera de LIVE");
+    expect(passes <= 2 * (schedStats.wakes - wakes), "sin vueltas en vacío entre plazos");
+    expect(schedStats.idleUs - idle > 1900000, "el loop duerme entre plazos");
+}
+
+static void testLedOff() {
+    runLoopFor(3);
+    unsigned long start = millis();
+    setLED(5, true);
+    setLED(6, true);
+    armLedOff(5, start + 150);
+    armLedOff(6, start + 40);
+    while (!passUntil([] { return !ledActive[6]; }) && millis() - start < 1000) {}
+    expect(millis() - start == 40, "LED apagado a los 40 ms");
+    while (!passUntil([] { return !ledActive[5]; }) && millis() - start < 1000) {}
+    expect(millis() - start == 150, "y el otro a los 150 ms");
+}
+
+static void testDisplayRevert() {
+    runLoopFor(3);
+    unsigned long start = millis();
+    showInstrumentOnTM1638(2);
+    expect(currentDisplayMode == DISPLAY_INSTRUMENT, "instrumento en el TM1638");
+    while (!passUntil([] { return currentDisplayMode != DISPLAY_INSTRUMENT; }) &&
+           millis() - start < 5000) {}
+    expect(millis() - start == INSTRUMENT_DISPLAY_MS, "vuelve al BPM a los 2 s");
+}
+
+// Medio ciclo de cuadratura en los pines del encoder, con la ISR en cada flanco
+static void encoderDetent() {
+    static uint8_t level = 0;
+    level ^= 1;
+    hostSetDigital(ENCODER_DT, level);
+    encoderISR();
+    hostSetDigital(ENCODER_CLK, level);
+    encoderISR();
+}
+
+static void testEncoderWake() {
+    hostSetDigital(ENCODER_SW, LOW);    // Sin pulsar (pull-up)
+    hostSetDigital(ENCODER_CLK, 0);
+    hostSetDigital(ENCODER_DT, 0);
+    encoderState = 0;
+    encoderSubSteps = 0;
+    runLoopFor(20);
+    readEncoder();
+
+    // Entradas recién atendidas: el próximo periodo queda lejos
+    schedAt(TASK_INPUT, micros() + INPUT_INTERVAL_MS * 1000UL);
+    int selection = menuSelection;
+    encoderDetent();
+    loop();
+    expect(menuSelection != selection, "un detent se atiende en la misma vuelta");
+}
+
+static VolumeMode volumeBefore;
+
+// El antirrebote del botón de volumen es un plazo: la vuelta del flanco no se queda
+// esperando y el cambio de modo llega a los VOLUME_DEBOUNCE_MS
+static void testVolumeDebounce() {
+    hostSetDigital(VOLUME_TOGGLE_BTN, HIGH);
+    runLoopFor(VOLUME_INTERVAL_MS + 1);
+    volumeBefore = volumeMode;
+
+    hostSetDigital(VOLUME_TOGGLE_BTN, LOW);
+    schedAt(TASK_VOLUME, micros());
+    unsigned long start = millis();
+    runDueTasks();
+    expect(millis() == start && volumeMode == volumeBefore, "el flanco no bloquea el loop");
+    while (!passUntil([] { return volumeMode != volumeBefore; }) && millis() - start < 1000) {}
+    expect(millis() - start == VOLUME_DEBOUNCE_MS, "cambio de modo a los 50 ms");
+
+    // Un rebote más corto que el antirrebote no cambia nada
+    hostSetDigital(VOLUME_TOGGLE_BTN, HIGH);
+    runLoopFor(VOLUME_INTERVAL_MS + 1);
+    volumeBefore = volumeMode;
+    hostSetDigital(VOLUME_TOGGLE_BTN, LOW);
+    schedAt(TASK_VOLUME, micros());
+    runDueTasks();
+    hostSetDigital(VOLUME_TOGGLE_BTN, HIGH);
+    runLoopFor(2 * VOLUME_INTERVAL_MS);
+    expect(volumeMode == volumeBefore, "rebote de menos de 50 ms: sin cambio");
+}
+
+static void testStepClock() {
+    tempo = 125;                        // 120 ms por step: no es múltiplo de 16 ms
+    calculateStepInterval();
+    runLoopFor(3);
+    currentStep = 0;
+    clockPrevStep = 0;
+    lastStepTime = millis();
+    isPlaying = true;
+
+    unsigned long last = millis();
+    int step = currentStep;
+    bool exact = true;
+    int changes = 0;
+    while (changes < 10) {
+        runDueTasks();
+        if (currentStep != step) {
+            if (millis() - last != stepInterval) exact = false;
+            last = millis();
+            step = currentStep;
+            changes++;
+        }
+        schedSleep();
+    }
+    isPlaying = false;
+    expect(exact, "en play cada step cae a su hora (120 ms, sin redondear a 16 ms)");
+}
+
+int main() {
+    tft.init();
+    tft.setRotation(3);
+    setupBandRenderer();
+    setupStripRenderer();
+    setupTileCache();
+    setupKits();
+    setupPatterns();
+    calculateStepInterval();
+    tmBusBegin();
+    currentScreen = SCREEN_MENU;
+    needsFullRedraw = true;
+    schedStart();
+
+    testPeriods();
+    testLedOff();
+    testDisplayRevert();
+    testEncoderWake();
+    testVolumeDebounce();
+    testStepClock();
+    return testResult();
+}
@@ -0,0 +1,184 @@
+// Arduino mínimo para compilar src/main.cpp en el host (test/host)
+// Solo lo que usa el firmware; el reloj es simulado y controlable desde los tests.
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define IRAM_ATTR
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define CHANGE 0x03
+#define PI 3.1415926535897932384626433832795
+#define ADC_11db 3
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Reloj simulado (hostAdvanceMicros lo mueve; delay() también avanza). El contador de
+// ciclos de la CPU avanza un poco en cada lectura para que las esperas activas terminen.
+#define HOST_CPU_MHZ 240
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void hostAdvanceMicros(unsigned long us);
+uint32_t hostCycleCount();
+
+// Entradas simuladas: pines digitales y ADC fijados por el test
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+int analogRead(uint8_t pin);
+void pinMode(uint8_t pin, uint8_t mode);
+void analogReadResolution(uint8_t bits);
+void analogSetAttenuation(int attenuation);
+void hostSetDigital(uint8_t pin, int value);
+void hostSetAnalog(uint8_t pin, int value);
+inline int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterrupt(int interrupt, void (*isr)(), int mode);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+inline void yield() {}
+
+class String {
+public:
+    String() {}
+    String(const char* c) : s(c ? c : "") {}
+    String(const std::string& str) : s(str) {}
+    String(char c) : s(1, c) {}
+    String(int v) : s(std::to_string(v)) {}
+    String(unsigned int v) : s(std::to_string(v)) {}
+    String(long v) : s(std::to_string(v)) {}
+    String(unsigned long v) : s(std::to_string(v)) {}
+    String(double v, unsigned int decimals = 2) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+        s = buf;
+    }
+
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    String substring(unsigned int from) const { return String(s.substr(min<size_t>(from, s.size()))); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > s.size()) from = s.size();
+        if (to > s.size()) to = s.size();
+        return String(s.substr(from, to > from ? to - from : 0));
+    }
+    void trim() {
+        size_t a = s.find_first_not_of(" \t\r\n");
+        size_t b = s.find_last_not_of(" \t\r\n");
+        s = (a == std::string::npos) ? "" : s.substr(a, b - a + 1);
+    }
+    int toInt() const { return atoi(s.c_str()); }
+    char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+
+    String operator+(const String& o) const { return String(s + o.s); }
+    String& operator+=(const String& o) { s += o.s; return *this; }
+    String& operator+=(const char* o) { s += o; return *this; }
+    String& operator+=(char c) { s += c; return *this; }
+    bool operator==(const String& o) const { return s == o.s; }
+    bool operator==(const char* o) const { return s == o; }
+    bool operator!=(const String& o) const { return s != o.s; }
+
+    std::string s;
+};
+inline String operator+(const char* a, const String& b) { return String(a) + b; }
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+
+    size_t print(const char* str) { return write(str); }
+    size_t print(const String& str) { return write(str.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned int v) { return print(String(v)); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+
+    size_t println() { return write("\r\n"); }
+    template<typename T> size_t println(const T& v) { return print(v) + println(); }
+    size_t println(double v, int decimals) { return print(v, decimals) + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        if (len < 0) return 0;
+        return write((const uint8_t*)buf, min<size_t>(len, sizeof(buf) - 1));
+    }
+};
+
+// Serial del host: silencioso salvo HOST_VERBOSE=1 en el entorno
+class HardwareSerial : public Print {
+public:
+    HardwareSerial(int uart = 0) {}
+    void begin(unsigned long baud, uint32_t config = 0, int8_t rx = -1, int8_t tx = -1) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    operator bool() { return true; }
+    size_t write(uint8_t c) override;
+    using Print::write;
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() { return 180 * 1024; }
+    uint32_t getHeapSize() { return 320 * 1024; }
+    uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+    uint32_t getCpuFreqMHz() { return HOST_CPU_MHZ; }
+    uint32_t getCycleCount();
+    const char* getChipModel() { return "HOST"; }
+};
+extern EspClass ESP;
+
+// FreeRTOS: sin tareas en el host (el build usa USE_BAND_RENDER=0)
+typedef void* QueueHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef void* TaskHandle_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+#define portMAX_DELAY 0xFFFFFFFF
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdMS_TO_TICKS(ms) (ms)
+inline QueueHandle_t xQueueCreate(UBaseType_t, UBaseType_t) { return nullptr; }
+inline BaseType_t xQueueSend(QueueHandle_t, const void*, TickType_t) { return pdFALSE; }
+inline BaseType_t xQueueReceive(QueueHandle_t, void*, TickType_t) { return pdFALSE; }
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return nullptr; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+inline BaseType_t xTaskCreatePinnedToCore(void (*)(void*), const char*, uint32_t, void*,
+                                          UBaseType_t, TaskHandle_t*, BaseType_t) { return pdFALSE; }
+inline void vTaskDelay(TickType_t ticks) { delay(ticks); }
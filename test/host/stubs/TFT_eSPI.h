@@ -0,0 +1,158 @@
+// TFT_eSPI del host: dibuja en un framebuffer RGB565 en memoria (480x320 tras
+// setRotation(3)) y cuenta llamadas y píxeles escritos. Mismo API que usa src/main.cpp;
+// las primitivas y la fuente 1 siguen los algoritmos de TFT_eSPI 2.5.x píxel a píxel
+// (textSize escala 6x8 por carácter). El firmware lo comprueba con checkChromeStrip().
+#pragma once
+#include <Arduino.h>
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_MAROON      0x7800
+#define TFT_RED         0xF800
+#define TFT_GREEN       0x07E0
+#define TFT_BLUE        0x001F
+#define TFT_CYAN        0x07FF
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_ORANGE      0xFDA0
+#define TFT_WHITE       0xFFFF
+#define TFT_DARKGREY    0x7BEF
+#define TFT_LIGHTGREY   0xD69A
+
+#define TL_DATUM 0
+#define MC_DATUM 4
+
+class TFT_eSPI;
+
+// SPI del host: los bytes enviados tras setAddrWindow son píxeles RGB666 (3 bytes, como
+// los del ILI9488) y se escriben en la ventana del TFT ya convertidos a RGB565
+class SPIClass {
+public:
+    void writeBytes(const uint8_t* data, uint32_t size);
+
+private:
+    friend class TFT_eSPI;
+    TFT_eSPI* _tft = nullptr;
+    uint8_t _pending[3];
+    int _pendingCount = 0;
+};
+
+struct TFTStats {
+    uint32_t calls;    // Llamadas de dibujo públicas
+    uint32_t pixels;   // Píxeles escritos (tras recortar)
+};
+
+class TFT_eSPI : public Print {
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI();
+
+    void init();
+    void setRotation(uint8_t r);
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    void fillScreen(uint32_t color);
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+    uint16_t readPixel(int32_t x, int32_t y) const;
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) const {
+        return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+
+    void setTextSize(uint8_t size) { _textSize = size ? size : 1; }
+    void setTextColor(uint16_t color) { _textColor = color; _textBgFill = false; }
+    void setTextColor(uint16_t color, uint16_t bg, bool fill = true) {
+        _textColor = color;
+        _textBg = bg;
+        _textBgFill = true;
+    }
+    void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    int16_t getCursorX() const { return _cursorX; }
+    int16_t getCursorY() const { return _cursorY; }
+    void setSwapBytes(bool swap) { _swapBytes = swap; }
+    bool getSwapBytes() const { return _swapBytes; }
+
+    void startWrite() {}
+    void endWrite() {}
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    SPIClass& getSPIinstance() { return _spi; }
+
+    // Viewport con datum: coordenadas relativas a (x, y) y recorte al área visible
+    void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+    void resetViewport();
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    // Solo host
+    const uint16_t* framebuffer() const { return _buffer; }
+    const TFTStats& stats() const { return _stats; }
+    void resetStats() { _stats = {0, 0}; }
+    uint64_t hash() const;                 // FNV-1a del framebuffer
+    bool writePPM(const char* path) const; // Volcado P6 (RGB888)
+
+protected:
+    friend class TFT_eSprite;
+    friend class SPIClass;
+    void windowPixel(uint16_t color);
+    void allocate(int16_t w, int16_t h);
+    void rawPixel(int32_t x, int32_t y, uint16_t color);
+    void rawHLine(int32_t x, int32_t y, int32_t w, uint16_t color);
+    void rawVLine(int32_t x, int32_t y, int32_t h, uint16_t color);
+    void rawFillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void rawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, uint16_t color);
+    void rawFillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, int32_t delta, uint16_t color);
+    void rawChar(int32_t x, int32_t y, uint8_t c);
+
+    uint16_t* _buffer = nullptr;
+    int16_t _width = 0;
+    int16_t _height = 0;
+    int16_t _cursorX = 0;
+    int16_t _cursorY = 0;
+    uint8_t _textSize = 1;
+    uint16_t _textColor = TFT_WHITE;
+    uint16_t _textBg = TFT_BLACK;
+    bool _textBgFill = false;
+    bool _swapBytes = false;
+    TFTStats _stats = {0, 0};
+    int32_t _xDatum = 0;
+    int32_t _yDatum = 0;
+    int32_t _vpX = 0;
+    int32_t _vpY = 0;
+    int32_t _vpW = 0;   // Borde derecho + 1
+    int32_t _vpH = 0;   // Borde inferior + 1
+    SPIClass _spi;
+    int32_t _winX = 0;  // Ventana de setAddrWindow y posición de escritura
+    int32_t _winY = 0;
+    int32_t _winW = 0;
+    int32_t _winH = 0;
+    int32_t _winPos = 0;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+    explicit TFT_eSprite(TFT_eSPI* parent) : TFT_eSPI(0, 0), _parent(parent) {}
+
+    void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void deleteSprite();
+    bool created() const { return _buffer != nullptr; }
+    void setColorDepth(int8_t depth) {}
+    void fillSprite(uint32_t color) { fillScreen(color); }
+    void pushSprite(int32_t x, int32_t y);
+    bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+private:
+    TFT_eSPI* _parent;
+};
@@ -0,0 +1,35 @@
+// WiFi del host: nunca conecta (las pantallas muestran el estado OFFLINE)
+#pragma once
+#include <Arduino.h>
+
+#define WL_IDLE_STATUS 0
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+#define WIFI_STA 1
+#define WIFI_AP 2
+
+class IPAddress {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : addr{a, b, c, d} {}
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr[0], addr[1], addr[2], addr[3]);
+        return String(buf);
+    }
+    operator String() const { return toString(); }
+    uint8_t addr[4];
+};
+
+class WiFiClass {
+public:
+    void mode(int m) {}
+    void begin(const char* ssid, const char* password) {}
+    bool config(IPAddress ip, IPAddress gateway, IPAddress subnet) { return true; }
+    int status() { return WL_DISCONNECTED; }
+    int scanNetworks() { return 0; }
+    String SSID(int i = 0) { return String(""); }
+    int32_t RSSI(int i = 0) { return 0; }
+    IPAddress localIP() { return IPAddress(); }
+    String macAddress() { return String("00:00:00:00:00:00"); }
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,15 @@
+// UDP del host: no recibe nada y descarta lo enviado (solo cuenta los paquetes)
+#pragma once
+#include <Arduino.h>
+
+class WiFiUDP {
+public:
+    uint8_t begin(uint16_t port) { return 1; }
+    int beginPacket(const char* host, uint16_t port) { return 1; }
+    size_t write(const uint8_t* buffer, size_t size) { return size; }
+    int endPacket() { sent++; return 1; }
+    int parsePacket() { return 0; }
+    int read(char* buffer, size_t len) { return 0; }
+
+    uint32_t sent = 0;   // Solo host
+};
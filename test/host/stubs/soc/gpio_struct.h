@@ -0,0 +1,46 @@
+// Registros GPIO del ESP32 que usa el driver de los TM1638 (mismos nombres que
+// soc/gpio_struct.h del IDF). Cada escritura llega a hostGpioWrite y las lecturas salen de
+// hostGpioRead: host_tm1638.cpp guarda el estado de los pines y simula los chips.
+#pragma once
+#include <stdint.h>
+
+enum HostGpioRegister {
+    HOST_GPIO_OUT_W1TS,
+    HOST_GPIO_OUT_W1TC,
+    HOST_GPIO_ENABLE_W1TS,
+    HOST_GPIO_ENABLE_W1TC,
+    HOST_GPIO_IN,
+    HOST_GPIO_OUT1_W1TS,
+    HOST_GPIO_OUT1_W1TC,
+    HOST_GPIO_ENABLE1_W1TS,
+    HOST_GPIO_ENABLE1_W1TC,
+    HOST_GPIO_IN1,
+};
+
+void hostGpioWrite(int reg, uint32_t value);
+uint32_t hostGpioRead(int reg);
+
+struct HostGpioWord {
+    int reg;
+    HostGpioWord& operator=(uint32_t value) { hostGpioWrite(reg, value); return *this; }
+    operator uint32_t() const { return hostGpioRead(reg); }
+};
+
+// Registros del banco 1 (GPIO 32-39): en el IDF son uniones con campo val
+struct HostGpioUnion {
+    HostGpioWord val;
+};
+
+struct HostGpioDev {
+    HostGpioWord out_w1ts{HOST_GPIO_OUT_W1TS};
+    HostGpioWord out_w1tc{HOST_GPIO_OUT_W1TC};
+    HostGpioWord enable_w1ts{HOST_GPIO_ENABLE_W1TS};
+    HostGpioWord enable_w1tc{HOST_GPIO_ENABLE_W1TC};
+    HostGpioWord in{HOST_GPIO_IN};
+    HostGpioUnion out1_w1ts{{HOST_GPIO_OUT1_W1TS}};
+    HostGpioUnion out1_w1tc{{HOST_GPIO_OUT1_W1TC}};
+    HostGpioUnion enable1_w1ts{{HOST_GPIO_ENABLE1_W1TS}};
+    HostGpioUnion enable1_w1tc{{HOST_GPIO_ENABLE1_W1TC}};
+    HostGpioUnion in1{{HOST_GPIO_IN1}};
+};
+extern HostGpioDev GPIO;
@@ -0,0 +1,124 @@
+// Test del driver doble de los TM1638: src/main.cpp habla con dos chips simulados bit a
+// bit (host_tm1638.cpp) y se comprueba lo que queda en su RAM, la lectura de teclas, el
+// protocolo y los tiempos, y que los dos chips compartan los ciclos de reloj.
+//
+//   make run            -> también ejecuta ./tm1638_test
+#include "../../src/main.cpp"
+#include "host_test.h"
+#include "host_tm1638.h"
+
+// La RAM de cada chip simulado debe ser la que pide la sombra
+static bool chipsMatchShadow() {
+    for (int c = 0; c < 2; c++) {
+        if (memcmp(tmSim[c].ram, tmShadow[c].next, 16) != 0) return false;
+        if (tmShadow[c].dirty) return false;
+    }
+    return true;
+}
+
+// Inversa del mapeo de readAllButtons: S(i+1) en el bit 0 del byte i, S(i+5) en el bit 4
+static void pressButtons(uint16_t buttons) {
+    for (int c = 0; c < 2; c++) {
+        uint8_t b = buttons >> (c * 8);
+        for (int i = 0; i < 4; i++) {
+            tmSim[c].keys[i] = ((b >> i) & 1) | (((b >> (i + 4)) & 1) << 4);
+        }
+    }
+}
+
+static void testInit() {
+    tmSimReset();
+    memset(tmSim[0].ram, 0xAA, 16);
+    memset(tmSim[1].ram, 0x55, 16);
+    tmBusBegin();
+    tmBrightness(7);
+    tmClear();
+    tmShadowReset(0);
+    tmShadowReset(1);
+    uint8_t zero[16] = {0};
+    expect(tmSim[0].control == 0x8F && tmSim[1].control == 0x8F, "brillo 7 y display encendido");
+    expect(!memcmp(tmSim[0].ram, zero, 16) && !memcmp(tmSim[1].ram, zero, 16), "RAM a 0 en los dos chips");
+    expect(tmSim[0].clocks == tmSim[1].clocks, "mismos relojes en los dos chips");
+}
+
+static void testImmediateWrite() {
+    uint32_t other = tmSim[1].transactions;
+    uint32_t writes = tmBusStats.writes;
+    tmDisplayText(0, "STEP1-8 ");
+    expect(tmSim[0].ram[0] == TM_FONT['S' - 0x20] && tmSim[0].ram[8] == TM_FONT['1' - 0x20],
+           "texto fuera del loop llega al chip 1");
+    expect(tmSim[1].transactions == other, "el chip 2 no se selecciona");
+    expect(tmBusStats.writes - writes == 1, "el texto entero en una ráfaga");
+    expect(chipsMatchShadow(), "RAM del chip = sombra");
+}
+
+static void testFrameWrite() {
+    uint32_t writes = tmBusStats.writes;
+    uint32_t transactions[2] = {tmSim[0].transactions, tmSim[1].transactions};
+    uint32_t clocks = tmSim[0].clocks;
+    tmBeginFrame();
+    tmDisplayText(0, "BPM 120.0");
+    tmDisplayText(1, "VOL  75 ");
+    setAllLEDs(0xA5C3);
+    int span = 16 - __builtin_clz((uint32_t)tmShadow[0].dirty << 16) - __builtin_ctz(tmShadow[0].dirty);
+    tmEndFrame();
+    expect(chipsMatchShadow(), "texto y LEDs de los dos chips en su RAM");
+    expect(tmSim[0].ram[9] == 0 && tmSim[0].ram[1] == 1 && tmSim[1].ram[15] == 1, "LEDs en los bytes impares");
+    expect(tmSim[0].ram[12] == (TM_FONT['0' - 0x20] | 0x80), "punto decimal unido al dígito");
+    expect(tmBusStats.writes - writes == 1 &&
+           tmSim[0].transactions - transactions[0] == 2 && tmSim[1].transactions - transactions[1] == 2,
+           "una ráfaga por chip y frame (modo + dirección y datos)");
+    expect(tmSim[0].clocks - clocks == (uint32_t)(16 + 8 * span), "ráfaga del tramo que cambia");
+
+    // Un solo LED que se mueve: ráfaga corta en un chip, el otro no se selecciona
+    transactions[1] = tmSim[1].transactions;
+    clocks = tmSim[0].clocks;
+    setAllLEDs(0xA5C3 ^ 0x0003);
+    expect(chipsMatchShadow() && tmSim[1].transactions == transactions[1] &&
+           tmSim[0].clocks - clocks == 16 + 8 * 3, "cambio de LEDs fuera del loop: una ráfaga");
+
+    // Repetir lo mismo no toca el bus
+    clocks = tmSim[0].clocks + tmSim[1].clocks;
+    tmBeginFrame();
+    tmDisplayText(0, "BPM 120.0");
+    setAllLEDs(0xA5C3 ^ 0x0003);
+    tmEndFrame();
+    expect(tmSim[0].clocks + tmSim[1].clocks == clocks, "sin cambios no hay relojes");
+}
+
+static void testButtons() {
+    bool allOk = true;
+    for (int i = 0; i < 16; i++) {
+        pressButtons(1 << i);
+        if (readAllButtons() != (1 << i)) allOk = false;
+    }
+    expect(allOk, "cada botón S1-S16 por separado");
+    static const uint16_t combos[] = {0x0000, 0xFFFF, 0x8001, 0x5AA5, 0x0F0F, 0xC33C};
+    allOk = true;
+    for (uint16_t combo : combos) {
+        pressButtons(combo);
+        if (readAllButtons() != combo) allOk = false;
+    }
+    expect(allOk, "combinaciones de botones en los dos chips");
+    uint32_t clocks0 = tmSim[0].clocks;
+    uint32_t clocks1 = tmSim[1].clocks;
+    uint32_t reads = tmBusStats.reads;
+    pressButtons(0);
+    readAllButtons();
+    expect(tmSim[0].clocks - clocks0 == 40 && tmSim[1].clocks - clocks1 == 40 &&
+           tmBusStats.reads - reads == 1,
+           "los dos chips en una lectura de 40 relojes (comando + 4 bytes)");
+
+    // El bus vuelve a escribir después de leer
+    tmDisplayText(1, "STE9-16 ");
+    expect(chipsMatchShadow(), "escritura tras lectura");
+}
+
+int main() {
+    testInit();
+    testImmediateWrite();
+    testFrameWrite();
+    testButtons();
+    expect(tmSimErrors == 0, "protocolo y tiempos del TM1638");
+    return testResult();
+}